@@ -0,0 +1,701 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/private/object.h"
+
+/**
+ * bignums are sign-magnitude arrays of 32-bit digits, least significant
+ * first. every bignum operation returns a fixnum whenever the result fits,
+ * so a bignum is never in the fixnum range.
+ */
+
+#define DIGIT_BITS 32
+#define DIGIT_BASE ((uint64_t)1 << DIGIT_BITS)
+
+#define KARATSUBA_THRESHOLD 32
+
+/* a read-only view of an exact integer, fixnum or bignum */
+struct bigview {
+  bool neg;
+  int len;
+  const uint32_t *digits;
+  uint32_t buf[2];
+};
+
+static void
+big_view(pic_state *pic, pic_value v, struct bigview *w)
+{
+  if (pic_int_p(pic, v)) {
+    pic_fixnum_t i = pic_fixnum(pic, v);
+    uint64_t m = i < 0 ? -(uint64_t)(int64_t)i : (uint64_t)i;
+
+    w->neg = i < 0;
+    w->buf[0] = (uint32_t)m;
+    w->buf[1] = (uint32_t)(m >> DIGIT_BITS);
+    w->len = w->buf[1] ? 2 : w->buf[0] ? 1 : 0;
+    w->digits = w->buf;
+  } else {
+    struct bignum *b = pic_bignum_ptr(pic, v);
+
+    w->neg = b->neg;
+    w->len = b->len;
+    w->digits = b->digits;
+  }
+}
+
+static int
+mag_len(const uint32_t *a, int an)
+{
+  while (an > 0 && a[an - 1] == 0) {
+    an--;
+  }
+  return an;
+}
+
+static pic_value
+big_make(pic_state *pic, bool neg, const uint32_t *digits, int len)
+{
+  struct bignum *b;
+
+  len = mag_len(digits, len);
+
+  if (len <= 2) {
+    uint64_t m = len == 0 ? 0 : len == 1 ? digits[0] : digits[0] | ((uint64_t)digits[1] << DIGIT_BITS);
+
+    if (! neg && m <= (uint64_t)PIC_FIXNUM_MAX) {
+      return pic_fixnum_value(pic, (pic_fixnum_t)m);
+    }
+    if (neg && m <= (uint64_t)PIC_FIXNUM_MAX + 1) {
+      return pic_fixnum_value(pic, (pic_fixnum_t)-(int64_t)m);
+    }
+  }
+
+  b = (struct bignum *)pic_obj_alloc(pic, offsetof(struct bignum, digits) + sizeof(uint32_t) * len, PIC_TYPE_BIGNUM);
+  b->neg = neg;
+  b->len = len;
+  memcpy(b->digits, digits, sizeof(uint32_t) * len);
+  return pic_obj_value(b);
+}
+
+/* magnitude kernels */
+
+static int
+mag_cmp(const uint32_t *a, int an, const uint32_t *b, int bn)
+{
+  int i;
+
+  an = mag_len(a, an);
+  bn = mag_len(b, bn);
+  if (an != bn) {
+    return an < bn ? -1 : 1;
+  }
+  for (i = an - 1; i >= 0; --i) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/* r[0..max(an,bn)] = a + b */
+static void
+mag_add(uint32_t *r, const uint32_t *a, int an, const uint32_t *b, int bn)
+{
+  uint64_t t, carry = 0;
+  int i;
+
+  if (an < bn) {
+    PIC_SWAP(const uint32_t *, a, b);
+    PIC_SWAP(int, an, bn);
+  }
+  for (i = 0; i < bn; ++i) {
+    t = (uint64_t)a[i] + b[i] + carry;
+    r[i] = (uint32_t)t;
+    carry = t >> DIGIT_BITS;
+  }
+  for (; i < an; ++i) {
+    t = (uint64_t)a[i] + carry;
+    r[i] = (uint32_t)t;
+    carry = t >> DIGIT_BITS;
+  }
+  r[an] = (uint32_t)carry;
+}
+
+/* r[0..an) = a - b, where a >= b */
+static void
+mag_sub(uint32_t *r, const uint32_t *a, int an, const uint32_t *b, int bn)
+{
+  uint64_t t, borrow = 0;
+  int i;
+
+  for (i = 0; i < bn; ++i) {
+    t = (uint64_t)a[i] - b[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = (t >> DIGIT_BITS) & 1;
+  }
+  for (; i < an; ++i) {
+    t = (uint64_t)a[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = (t >> DIGIT_BITS) & 1;
+  }
+  assert(borrow == 0);
+}
+
+/* r[0..rn) += a[0..an); the sum must fit in rn digits */
+static void
+mag_add_into(uint32_t *r, int rn, const uint32_t *a, int an)
+{
+  uint64_t t, carry = 0;
+  int i;
+
+  for (i = 0; i < an; ++i) {
+    t = (uint64_t)r[i] + a[i] + carry;
+    r[i] = (uint32_t)t;
+    carry = t >> DIGIT_BITS;
+  }
+  for (; carry && i < rn; ++i) {
+    t = (uint64_t)r[i] + carry;
+    r[i] = (uint32_t)t;
+    carry = t >> DIGIT_BITS;
+  }
+}
+
+/* r[0..rn) -= a[0..an); the difference must be non-negative */
+static void
+mag_sub_into(uint32_t *r, int rn, const uint32_t *a, int an)
+{
+  uint64_t t, borrow = 0;
+  int i;
+
+  for (i = 0; i < an; ++i) {
+    t = (uint64_t)r[i] - a[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = (t >> DIGIT_BITS) & 1;
+  }
+  for (; borrow && i < rn; ++i) {
+    t = (uint64_t)r[i] - borrow;
+    r[i] = (uint32_t)t;
+    borrow = (t >> DIGIT_BITS) & 1;
+  }
+}
+
+/* r[0..an+bn) = a * b */
+static void
+mag_mul_school(uint32_t *r, const uint32_t *a, int an, const uint32_t *b, int bn)
+{
+  uint64_t t, carry;
+  int i, j;
+
+  memset(r, 0, sizeof(uint32_t) * (an + bn));
+  for (i = 0; i < an; ++i) {
+    if (a[i] == 0) {
+      continue;
+    }
+    carry = 0;
+    for (j = 0; j < bn; ++j) {
+      t = (uint64_t)a[i] * b[j] + r[i + j] + carry;
+      r[i + j] = (uint32_t)t;
+      carry = t >> DIGIT_BITS;
+    }
+    r[i + bn] = (uint32_t)carry;
+  }
+}
+
+/* r[0..an+bn) = a * b */
+static void
+mag_mul(pic_state *pic, uint32_t *r, const uint32_t *a, int an, const uint32_t *b, int bn)
+{
+  uint32_t *t;
+  int h, i, m;
+
+  if (an < bn) {
+    PIC_SWAP(const uint32_t *, a, b);
+    PIC_SWAP(int, an, bn);
+  }
+
+  if (bn < KARATSUBA_THRESHOLD) {
+    mag_mul_school(r, a, an, b, bn);
+    return;
+  }
+
+  if (2 * bn <= an) {
+    /* unbalanced: multiply b by bn-digit slices of a */
+    memset(r, 0, sizeof(uint32_t) * (an + bn));
+    t = pic_malloc(pic, sizeof(uint32_t) * 2 * bn);
+    for (i = 0; i < an; i += bn) {
+      m = an - i < bn ? an - i : bn;
+      mag_mul(pic, t, a + i, m, b, bn);
+      mag_add_into(r + i, an + bn - i, t, m + bn);
+    }
+    pic_free(pic, t);
+    return;
+  }
+
+  /**
+   * karatsuba: with a = a1 B^h + a0 and b = b1 B^h + b0,
+   *   a b = z2 B^2h + (z1 - z2 - z0) B^h + z0
+   * where z2 = a1 b1, z0 = a0 b0 and z1 = (a1 + a0)(b1 + b0).
+   */
+  h = (an + 1) / 2;
+
+  t = pic_malloc(pic, sizeof(uint32_t) * (4 * h + 4));
+
+  memset(r, 0, sizeof(uint32_t) * (an + bn));
+  mag_mul(pic, r, a, h, b, h);
+  if (bn > h) {
+    mag_mul(pic, r + 2 * h, a + h, an - h, b + h, bn - h);
+  }
+
+  mag_add(t, a, h, a + h, an - h);                 /* t[0..h] = a0 + a1 */
+  mag_add(t + h + 1, b, h, b + h, bn - h);         /* t[h+1..2h+1] = b0 + b1 */
+  {
+    uint32_t *z1 = t + 2 * h + 2;
+
+    mag_mul(pic, z1, t, h + 1, t + h + 1, h + 1); /* z1[0..2h+2) */
+    mag_sub_into(z1, 2 * h + 2, r, 2 * h);
+    if (bn > h) {
+      mag_sub_into(z1, 2 * h + 2, r + 2 * h, an + bn - 2 * h);
+    }
+    mag_add_into(r + h, an + bn - h, z1, mag_len(z1, 2 * h + 2));
+  }
+
+  pic_free(pic, t);
+}
+
+/* q[0..an) = a / d, returns a % d */
+static uint32_t
+mag_divmod_small(uint32_t *q, const uint32_t *a, int an, uint32_t d)
+{
+  uint64_t cur, rem = 0;
+  int i;
+
+  for (i = an - 1; i >= 0; --i) {
+    cur = (rem << DIGIT_BITS) | a[i];
+    q[i] = (uint32_t)(cur / d);
+    rem = cur % d;
+  }
+  return (uint32_t)rem;
+}
+
+static int
+nlz(uint32_t x)
+{
+  int n = 0;
+
+  while (! (x & 0x80000000u)) {
+    x <<= 1;
+    n++;
+  }
+  return n;
+}
+
+/**
+ * Knuth's algorithm D: q[0..m-n] = u / v and r[0..n) = u % v,
+ * where m >= n and v[n-1] != 0.
+ */
+static void
+mag_divmod(pic_state *pic, uint32_t *q, uint32_t *r, const uint32_t *u, int m, const uint32_t *v, int n)
+{
+  uint32_t *un, *vn;
+  uint64_t num, qhat, rhat, p;
+  int64_t t, k;
+  int s, i, j;
+
+  if (n == 1) {
+    r[0] = mag_divmod_small(q, u, m, v[0]);
+    return;
+  }
+
+  /* normalize so that the top digit of the divisor has its high bit set */
+  s = nlz(v[n - 1]);
+  vn = pic_malloc(pic, sizeof(uint32_t) * n);
+  un = pic_malloc(pic, sizeof(uint32_t) * (m + 1));
+  for (i = n - 1; i > 0; --i) {
+    vn[i] = (v[i] << s) | (s ? v[i - 1] >> (DIGIT_BITS - s) : 0);
+  }
+  vn[0] = v[0] << s;
+  un[m] = s ? u[m - 1] >> (DIGIT_BITS - s) : 0;
+  for (i = m - 1; i > 0; --i) {
+    un[i] = (u[i] << s) | (s ? u[i - 1] >> (DIGIT_BITS - s) : 0);
+  }
+  un[0] = u[0] << s;
+
+  for (j = m - n; j >= 0; --j) {
+    num = ((uint64_t)un[j + n] << DIGIT_BITS) | un[j + n - 1];
+    qhat = num / vn[n - 1];
+    rhat = num % vn[n - 1];
+    while (qhat >= DIGIT_BASE || qhat * vn[n - 2] > ((rhat << DIGIT_BITS) | un[j + n - 2])) {
+      qhat--;
+      rhat += vn[n - 1];
+      if (rhat >= DIGIT_BASE)
+        break;
+    }
+
+    /* multiply and subtract */
+    k = 0;
+    for (i = 0; i < n; ++i) {
+      p = qhat * vn[i];
+      t = (int64_t)un[i + j] - k - (int64_t)(p & 0xffffffffu);
+      un[i + j] = (uint32_t)t;
+      k = (int64_t)(p >> DIGIT_BITS) - (t >> DIGIT_BITS);
+    }
+    t = (int64_t)un[j + n] - k;
+    un[j + n] = (uint32_t)t;
+
+    q[j] = (uint32_t)qhat;
+    if (t < 0) {
+      /* add back */
+      q[j]--;
+      k = 0;
+      for (i = 0; i < n; ++i) {
+        t = (int64_t)un[i + j] + vn[i] + k;
+        un[i + j] = (uint32_t)t;
+        k = t >> DIGIT_BITS;
+      }
+      un[j + n] += (uint32_t)k;
+    }
+  }
+
+  for (i = 0; i < n - 1; ++i) {
+    r[i] = (un[i] >> s) | (s ? un[i + 1] << (DIGIT_BITS - s) : 0);
+  }
+  r[n - 1] = un[n - 1] >> s;
+
+  pic_free(pic, un);
+  pic_free(pic, vn);
+}
+
+/* arithmetic on exact integers */
+
+static pic_value
+big_addsub(pic_state *pic, pic_value x, pic_value y, bool sub)
+{
+  struct bigview a, b;
+  uint32_t *r;
+  bool bneg, neg;
+  int n;
+  pic_value v;
+
+  big_view(pic, x, &a);
+  big_view(pic, y, &b);
+  bneg = b.neg ^ sub;
+
+  n = (a.len > b.len ? a.len : b.len) + 1;
+  r = pic_malloc(pic, sizeof(uint32_t) * n);
+  if (a.neg == bneg) {
+    mag_add(r, a.digits, a.len, b.digits, b.len);
+    neg = a.neg;
+  } else if (mag_cmp(a.digits, a.len, b.digits, b.len) >= 0) {
+    mag_sub(r, a.digits, a.len, b.digits, b.len);
+    r[n - 1] = 0;
+    neg = a.neg;
+  } else {
+    mag_sub(r, b.digits, b.len, a.digits, a.len);
+    r[n - 1] = 0;
+    neg = bneg;
+  }
+  v = big_make(pic, neg, r, n);
+  pic_free(pic, r);
+  return v;
+}
+
+pic_value
+pic_big_add(pic_state *pic, pic_value x, pic_value y)
+{
+  return big_addsub(pic, x, y, false);
+}
+
+pic_value
+pic_big_sub(pic_state *pic, pic_value x, pic_value y)
+{
+  return big_addsub(pic, x, y, true);
+}
+
+pic_value
+pic_big_mul(pic_state *pic, pic_value x, pic_value y)
+{
+  struct bigview a, b;
+  uint32_t *r;
+  pic_value v;
+
+  big_view(pic, x, &a);
+  big_view(pic, y, &b);
+
+  if (a.len == 0 || b.len == 0) {
+    return pic_fixnum_value(pic, 0);
+  }
+  r = pic_malloc(pic, sizeof(uint32_t) * (a.len + b.len));
+  mag_mul(pic, r, a.digits, a.len, b.digits, b.len);
+  v = big_make(pic, a.neg ^ b.neg, r, a.len + b.len);
+  pic_free(pic, r);
+  return v;
+}
+
+/* exact quotient if y divides x, a flonum otherwise */
+pic_value
+pic_big_div(pic_state *pic, pic_value x, pic_value y)
+{
+  struct bigview a, b;
+  uint32_t *q, *r;
+  pic_value v;
+
+  big_view(pic, x, &a);
+  big_view(pic, y, &b);
+
+  if (b.len == 0 || a.len < b.len) {
+    if (a.len == 0 && b.len != 0) {
+      return pic_fixnum_value(pic, 0);
+    }
+    return pic_float_value(pic, pic_big_to_double(pic, x) / pic_big_to_double(pic, y));
+  }
+
+  q = pic_malloc(pic, sizeof(uint32_t) * (a.len - b.len + 1));
+  r = pic_malloc(pic, sizeof(uint32_t) * b.len);
+  mag_divmod(pic, q, r, a.digits, a.len, b.digits, b.len);
+  if (mag_len(r, b.len) == 0) {
+    v = big_make(pic, a.neg ^ b.neg, q, a.len - b.len + 1);
+  } else {
+    v = pic_float_value(pic, pic_big_to_double(pic, x) / pic_big_to_double(pic, y));
+  }
+  pic_free(pic, r);
+  pic_free(pic, q);
+  return v;
+}
+
+int
+pic_big_cmp(pic_state *pic, pic_value x, pic_value y)
+{
+  struct bigview a, b;
+  int c;
+
+  big_view(pic, x, &a);
+  big_view(pic, y, &b);
+
+  if (a.neg != b.neg) {
+    return a.neg ? -1 : 1;
+  }
+  c = mag_cmp(a.digits, a.len, b.digits, b.len);
+  return a.neg ? -c : c;
+}
+
+/* conversion */
+
+double
+pic_big_to_double(pic_state *pic, pic_value x)
+{
+  struct bigview a;
+  double f = 0;
+  int i;
+
+  big_view(pic, x, &a);
+
+  for (i = a.len - 1; i >= 0; --i) {
+    f = f * (double)DIGIT_BASE + a.digits[i];
+  }
+  return a.neg ? -f : f;
+}
+
+/* f must be finite; the fraction is truncated */
+pic_value
+pic_big_from_double(pic_state *pic, double f)
+{
+  uint32_t *r;
+  double scale = 1;
+  bool neg = f < 0;
+  int n = 1, i;
+  pic_value v;
+
+  if (neg) {
+    f = -f;
+  }
+  while (f / scale >= (double)DIGIT_BASE) {
+    scale *= (double)DIGIT_BASE;
+    n++;
+  }
+
+  /* scale is a power of two, so every step below is exact */
+  r = pic_malloc(pic, sizeof(uint32_t) * n);
+  for (i = n - 1; i >= 0; --i) {
+    r[i] = (uint32_t)(f / scale);
+    f -= r[i] * scale;
+    scale /= (double)DIGIT_BASE;
+  }
+  v = big_make(pic, neg, r, n);
+  pic_free(pic, r);
+  return v;
+}
+
+pic_value
+pic_big_from_int64(pic_state *pic, int64_t i)
+{
+  uint64_t m = i < 0 ? -(uint64_t)i : (uint64_t)i;
+  uint32_t r[2];
+
+  r[0] = (uint32_t)m;
+  r[1] = (uint32_t)(m >> DIGIT_BITS);
+  return big_make(pic, i < 0, r, 2);
+}
+
+bool
+pic_big_to_int64(pic_state *pic, pic_value x, int64_t *i)
+{
+  struct bigview w;
+  uint64_t m;
+
+  big_view(pic, x, &w);
+  if (w.len > 2) {
+    return false;
+  }
+  m = w.len == 0 ? 0 : w.len == 1 ? w.digits[0] : w.digits[0] | ((uint64_t)w.digits[1] << DIGIT_BITS);
+  if (! w.neg) {
+    if (m > (uint64_t)INT64_MAX) {
+      return false;
+    }
+    *i = (int64_t)m;
+  } else {
+    if (m > (uint64_t)INT64_MAX + 1) {
+      return false;
+    }
+    *i = m == (uint64_t)INT64_MAX + 1 ? INT64_MIN : -(int64_t)m;
+  }
+  return true;
+}
+
+/* largest power of radix that fits in a digit, converted k characters at a time */
+static uint32_t
+chunk_size(int radix, int *k)
+{
+  uint64_t p = radix;
+
+  *k = 1;
+  while (p * radix < DIGIT_BASE) {
+    p *= radix;
+    (*k)++;
+  }
+  return (uint32_t)p;
+}
+
+pic_value
+pic_big_to_string(pic_state *pic, pic_value x, int radix)
+{
+  static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  struct bigview a;
+  uint32_t *t, p, rem;
+  char *buf, *end, *c;
+  int n, k, i;
+  pic_value str;
+
+  assert(2 <= radix && radix <= 36);
+
+  big_view(pic, x, &a);
+
+  if (a.len == 0) {
+    return pic_lit_value(pic, "0");
+  }
+
+  p = chunk_size(radix, &k);
+
+  t = pic_malloc(pic, sizeof(uint32_t) * a.len);
+  memcpy(t, a.digits, sizeof(uint32_t) * a.len);
+  n = a.len;
+
+  buf = pic_malloc(pic, DIGIT_BITS * n + 2);
+  c = end = buf + DIGIT_BITS * n + 2;
+
+  /* peel off k digits per division by p */
+  while (n > 0) {
+    rem = mag_divmod_small(t, t, n, p);
+    n = mag_len(t, n);
+    for (i = 0; i < k && (n > 0 || rem > 0); ++i) {
+      *--c = digits[rem % radix];
+      rem /= radix;
+    }
+  }
+  if (a.neg) {
+    *--c = '-';
+  }
+
+  str = pic_str_value(pic, c, end - c);
+  pic_free(pic, buf);
+  pic_free(pic, t);
+  return str;
+}
+
+static int
+digit_value(int c, int radix)
+{
+  int d;
+
+  if ('0' <= c && c <= '9') {
+    d = c - '0';
+  } else if ('a' <= c && c <= 'z') {
+    d = c - 'a' + 10;
+  } else if ('A' <= c && c <= 'Z') {
+    d = c - 'A' + 10;
+  } else {
+    return -1;
+  }
+  return d < radix ? d : -1;
+}
+
+/* parses [+-]digits in the given radix; returns #f unless the whole string is an integer */
+pic_value
+pic_big_from_string(pic_state *pic, const char *str, int radix)
+{
+  const char *s = str;
+  uint32_t *r, chunk, carry;
+  uint64_t t;
+  bool neg = false;
+  int ndigits, n, k, m, i, j;
+  pic_value v;
+
+  assert(2 <= radix && radix <= 36);
+
+  if (*s == '+' || *s == '-') {
+    neg = *s++ == '-';
+  }
+  for (ndigits = 0; s[ndigits] != '\0'; ++ndigits) {
+    if (digit_value(s[ndigits], radix) < 0) {
+      return pic_false_value(pic);
+    }
+  }
+  if (ndigits == 0) {
+    return pic_false_value(pic);
+  }
+
+  chunk_size(radix, &k);
+
+  /* each character carries less than 6 bits */
+  r = pic_malloc(pic, sizeof(uint32_t) * (ndigits * 6 / DIGIT_BITS + 2));
+  n = 0;
+
+  /* the first chunk takes the leftover so that the rest are exactly k long */
+  m = ndigits % k ? ndigits % k : k;
+  for (i = 0; i < ndigits; i += m, m = k) {
+    uint32_t scale = 1;
+
+    chunk = 0;
+    for (j = 0; j < m; ++j) {
+      chunk = chunk * radix + digit_value(s[i + j], radix);
+      scale *= radix;
+    }
+
+    /* r = r * scale + chunk */
+    carry = chunk;
+    for (j = 0; j < n; ++j) {
+      t = (uint64_t)r[j] * scale + carry;
+      r[j] = (uint32_t)t;
+      carry = (uint32_t)(t >> DIGIT_BITS);
+    }
+    if (carry) {
+      r[n++] = carry;
+    }
+  }
+
+  v = big_make(pic, neg, r, n);
+  pic_free(pic, r);
+  return v;
+}
@@ -11,8 +11,13 @@ pic_blob_value(pic_state *pic, const unsigned char *buf, int len)
 {
   struct blob *bv;
 
-  bv = (struct blob *)pic_obj_alloc(pic, sizeof(struct blob), PIC_TYPE_BLOB);
-  bv->data = pic_malloc(pic, len);
+  if (len <= PIC_BLOB_INLINE_SIZE) {
+    bv = (struct blob *)pic_obj_alloc(pic, offsetof(struct blob, storage) + len, PIC_TYPE_BLOB);
+    bv->data = bv->storage;
+  } else {
+    bv = (struct blob *)pic_obj_alloc(pic, sizeof(struct blob), PIC_TYPE_BLOB);
+    bv->data = pic_malloc(pic, len);
+  }
   bv->len = len;
   if (buf) {
     memcpy(bv->data, buf, len);
@@ -20,6 +25,25 @@ pic_blob_value(pic_state *pic, const unsigned char *buf, int len)
   return pic_obj_value(bv);
 }
 
+/* the blob takes over data instead of copying it, unless it is short enough
+   to live in the cell */
+pic_value
+pic_adopt_blob(pic_state *pic, unsigned char *data, int len)
+{
+  struct blob *bv;
+  pic_value blob;
+
+  if (len <= PIC_BLOB_INLINE_SIZE) {
+    blob = pic_blob_value(pic, data, len);
+    pic_free(pic, data);
+    return blob;
+  }
+  bv = (struct blob *)pic_obj_alloc(pic, sizeof(struct blob), PIC_TYPE_BLOB);
+  bv->data = data;
+  bv->len = len;
+  return pic_obj_value(bv);
+}
+
 unsigned char *
 pic_blob(pic_state *PIC_UNUSED(pic), pic_value blob, int *len)
 {
@@ -14,11 +14,38 @@ pic_eq_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
 }
 
 bool
-pic_eqv_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
+pic_eqv_p(pic_state *pic, pic_value x, pic_value y)
+{
+  if (x == y)
+    return true;
+
+  return pic_bignum_p(pic, x) && pic_bignum_p(pic, y) && pic_big_cmp(pic, x, y) == 0;
+}
+
+#elif PIC_WORD_BOXING
+
+bool
+pic_eq_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
 {
   return x == y;
 }
 
+bool
+pic_eqv_p(pic_state *pic, pic_value x, pic_value y)
+{
+  if (x == y)
+    return true;
+
+  switch (pic_type(pic, x)) {
+  case PIC_TYPE_FLOAT:          /* flonums are boxed */
+    return pic_float_p(pic, y) && pic_float(pic, x) == pic_float(pic, y);
+  case PIC_TYPE_BIGNUM:
+    return pic_bignum_p(pic, y) && pic_big_cmp(pic, x, y) == 0;
+  default:
+    return false;
+  }
+}
+
 #else
 
 bool
@@ -52,6 +79,8 @@ pic_eqv_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
     return pic_float(pic, x) == pic_float(pic, y);
   case PIC_TYPE_INT:
     return pic_int(pic, x) == pic_int(pic, y);
+  case PIC_TYPE_BIGNUM:
+    return pic_big_cmp(pic, x, y) == 0;
   default:
     return pic_obj_ptr(x) == pic_obj_ptr(y);
   }
@@ -106,7 +135,7 @@ internal_equal_p(pic_state *pic, pic_value x, pic_value y, int depth, khash_t(m)
     return pic_eq_p(pic, s1, s2);
   }
   case PIC_TYPE_STRING: {
-    return pic_str_cmp(pic, x, y) == 0;
+    return pic_str_equal_p(pic, x, y);
   }
   case PIC_TYPE_BLOB: {
     int xlen, ylen;
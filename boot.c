@@ -700,43 +700,63 @@ open IN, "./boot.c";
 my @data = <IN>;
 close IN;
 
-open STDOUT, ">", "./boot.c";
+# The library is compiled at build time: boot.c is first written without
+# an image, so that a program linked with it boots from source and dumps
+# the result, which is then written into boot.c. Run again after changing
+# the compiler or the image format.
 
-foreach (@data) {
-  print;
-  last if $_ eq "#---END---\n";
-}
+sub emit {
+  my $image = shift;
+
+  open OUT, ">", "./boot.c";
+
+  foreach (@data) {
+    print OUT;
+    last if $_ eq "#---END---\n";
+  }
 
-print "\n#endif\n\n";
+  print OUT "\n#endif\n\n";
 
-print <<EOL;
+  print OUT <<EOL;
 #include "picrin.h"
 #include "picrin/extra.h"
+#include "picrin/private/object.h"
 
 static const char boot_rom[][80] = {
 EOL
 
-my @lines = $src =~ /.{0,80}/gs;
+  my @lines = $src =~ /.{0,80}/gs;
 
-foreach (@lines) {
-  s/\\/\\\\/g;
-  s/"/\\"/g;
-  s/\n/\\n/g;
-  print "\"$_\",\n";
-}
-print "\"\"\n";
+  foreach (@lines) {
+    s/\\/\\\\/g;
+    s/"/\\"/g;
+    s/\n/\\n/g;
+    print OUT "\"$_\",\n";
+  }
+  print OUT "\"\"\n";
+
+  print OUT "};\n\nstatic const unsigned char boot_image[] = {\n";
+
+  my @bytes = unpack "C*", $image;
+  @bytes = (0) unless @bytes;   # not an image; boots from source
+
+  while (my @row = splice @bytes, 0, 16) {
+    print OUT join(",", @row), ",\n";
+  }
 
 =pod
 */
 =cut
 
-print <<EOL;
+  print OUT <<EOL;
 };
 
 void
 pic_boot(pic_state *pic)
 {
-  pic_load_cstr(pic, &boot_rom[0][0]);
+  if (! pic_restore(pic, boot_image, sizeof boot_image)) {
+    pic_load_cstr(pic, &boot_rom[0][0]);
+  }
 }
 
 #if 0
@@ -748,6 +768,37 @@ End:
 #endif
 EOL
 
+  close OUT;
+}
+
+emit("");
+
+my $cc = $ENV{CC} || "cc";
+
+open CC, "|-", "$cc -w -Iinclude -o boot-dump *.c -x c - -lm" or die;
+print CC <<EOL;
+#include "picrin.h"
+#include "picrin/extra.h"
+
+int
+main()
+{
+  pic_state *pic = pic_open(pic_default_allocf, NULL);
+
+  pic_snapshot(pic, xstdout);
+  xfflush(pic, xstdout);
+  pic_close(pic);
+  return 0;
+}
+EOL
+close CC or die "cannot build boot-dump";
+
+my $image = `./boot-dump`;
+die "boot-dump failed" if $?;
+unlink "boot-dump";
+
+emit($image);
+
 =pod
 
 #---END---
@@ -756,6 +807,7 @@ EOL
 
 #include "picrin.h"
 #include "picrin/extra.h"
+#include "picrin/private/object.h"
 
 static const char boot_rom[][80] = {
 "\n(builtin:define-macro call-with-current-environment\n  (builtin:lambda (form env",
@@ -1065,10 +1117,1611 @@ static const char boot_rom[][80] = {
 ""
 };
 
+static const unsigned char boot_image[] = {
+0,80,73,67,73,77,71,1,93,250,7,0,3,2,2,0,
+15,2,0,0,2,0,0,5,0,0,14,10,0,1,0,0,
+23,0,0,14,10,0,1,0,0,23,2,0,14,12,0,1,
+0,0,13,12,0,13,2,0,26,0,0,21,4,0,0,0,
+2,0,0,2,10,2,0,132,1,2,0,0,2,0,0,11,
+0,0,13,2,0,10,2,0,20,6,0,14,4,0,1,0,
+0,13,4,0,18,242,1,0,13,2,0,28,0,0,18,6,
+0,5,0,0,17,12,0,11,4,0,13,2,0,11,6,0,
+20,2,0,20,6,0,14,6,0,1,0,0,13,6,0,18,
+208,1,0,13,2,0,29,0,0,18,6,0,5,0,0,17,
+178,1,0,13,2,0,25,0,0,14,10,0,1,0,0,11,
+8,0,13,10,0,10,10,0,20,6,0,14,12,0,1,0,
+0,13,12,0,18,6,0,5,0,0,17,4,0,13,12,0,
+18,132,1,0,11,12,0,13,10,0,10,14,0,20,6,0,
+14,14,0,1,0,0,13,14,0,18,6,0,5,0,0,17,
+4,0,13,14,0,18,94,0,11,16,0,13,10,0,10,18,
+0,20,6,0,14,16,0,1,0,0,13,16,0,18,6,0,
+5,0,0,17,4,0,13,16,0,18,54,0,11,20,0,13,
+10,0,10,22,0,20,6,0,14,20,0,1,0,0,13,20,
+0,18,6,0,5,0,0,17,4,0,13,20,0,18,14,0,
+4,0,0,18,6,0,2,0,0,17,4,0,5,0,0,17,
+16,0,23,0,0,14,26,0,1,0,0,13,26,0,13,2,
+0,26,0,0,20,4,0,17,16,0,23,2,0,14,24,0,
+1,0,0,13,24,0,13,2,0,26,0,0,20,4,0,17,
+14,0,15,2,0,11,24,0,13,2,0,20,4,0,20,4,
+0,19,0,0,17,16,0,11,26,0,11,28,0,11,30,0,
+13,2,0,20,4,0,20,4,0,20,4,0,14,8,0,1,
+0,0,13,8,0,18,8,0,5,0,0,22,0,0,17,6,
+0,13,8,0,22,0,0,17,6,0,13,6,0,22,0,0,
+17,6,0,13,4,0,22,0,0,0,0,2,16,0,2,0,
+0,0,26,13,2,0,27,0,0,18,44,0,15,2,0,11,
+0,0,13,2,0,20,4,0,20,4,0,18,12,0,15,2,
+2,13,2,0,26,0,0,21,4,0,17,20,0,11,2,0,
+11,4,0,11,6,0,13,2,0,20,4,0,3,0,0,20,
+6,0,24,0,0,22,0,0,17,6,0,2,0,0,22,0,
+0,0,0,0,4,0,2,2,0,0,30,13,2,0,29,0,
+0,18,8,0,5,0,0,22,0,0,17,50,0,15,4,0,
+13,2,0,25,0,0,20,4,0,14,4,0,1,0,0,13,
+4,0,18,30,0,15,2,2,13,2,0,26,0,0,20,4,
+0,14,6,0,1,0,0,13,6,0,18,8,0,5,0,0,
+22,0,0,17,6,0,13,6,0,22,0,0,17,6,0,13,
+4,0,22,0,0,0,0,0,0,0,2,2,0,0,29,13,
+2,0,27,0,0,14,4,0,1,0,0,13,4,0,18,44,
+0,15,4,0,13,2,0,25,0,0,20,4,0,18,6,0,
+5,0,0,17,10,0,15,2,0,13,2,0,26,0,0,20,
+4,0,14,6,0,1,0,0,13,6,0,18,8,0,5,0,
+0,22,0,0,17,6,0,13,6,0,22,0,0,17,6,0,
+13,4,0,22,0,0,0,0,0,0,0,2,0,0,0,31,
+13,2,0,27,0,0,18,54,0,11,0,0,13,2,0,20,
+4,0,18,40,0,13,2,0,29,0,0,18,8,0,5,0,
+0,22,0,0,17,26,0,11,2,0,13,2,0,25,0,0,
+20,4,0,18,8,0,5,0,0,22,0,0,17,10,0,11,
+4,0,13,2,0,26,0,0,21,4,0,17,6,0,4,0,
+0,22,0,0,17,6,0,4,0,0,22,0,0,0,0,0,
+3,0,3,4,1,0,37,2,0,0,11,0,0,11,2,0,
+13,2,0,20,4,0,20,4,0,14,14,0,1,0,0,11,
+4,0,13,2,0,20,4,0,14,8,0,1,0,0,11,6,
+0,13,14,0,20,4,0,14,10,0,1,0,0,13,10,0,
+18,24,0,11,8,0,13,14,0,20,4,0,14,12,0,1,
+0,0,13,12,0,18,6,0,5,0,0,17,4,0,13,12,
+0,17,4,0,13,10,0,1,0,0,11,10,0,23,0,0,
+13,8,0,21,6,0,0,0,1,6,0,2,0,0,0,4,
+11,0,0,13,2,0,15,2,0,21,6,0,0,0,0,1,
+0,3,2,1,0,18,2,0,0,5,0,0,14,10,0,1,
+0,0,5,0,0,14,8,0,1,0,0,23,0,0,14,10,
+0,1,0,0,23,2,0,14,8,0,1,0,0,11,0,0,
+13,8,0,13,2,0,26,0,0,21,6,0,0,0,2,1,
+0,2,0,0,0,42,13,2,0,28,0,0,18,72,0,11,
+0,0,13,2,0,20,4,0,18,6,0,5,0,0,17,28,
+0,11,2,0,13,2,0,20,4,0,6,0,0,34,0,0,
+18,6,0,5,0,0,17,12,0,11,4,0,13,2,0,25,
+0,0,10,6,0,20,6,0,18,10,0,11,8,0,10,10,
+0,21,4,0,17,22,0,11,12,0,13,2,0,6,2,0,
+20,6,0,11,14,0,13,2,0,6,4,0,20,6,0,24,
+0,0,22,0,0,17,10,0,13,2,0,13,2,0,24,0,
+0,22,0,0,3,6,2,4,0,0,8,0,2,1,0,0,
+11,15,2,0,13,2,0,20,4,0,14,4,0,1,0,0,
+11,0,0,13,4,0,25,0,0,13,4,0,26,0,0,21,
+6,0,0,0,0,1,0,2,2,0,0,23,13,2,0,27,
+0,0,18,6,0,2,0,0,17,10,0,11,0,0,10,2,
+0,13,2,0,20,6,0,1,0,0,23,0,0,14,4,0,
+1,0,0,23,2,0,14,6,0,1,0,0,13,6,0,11,
+4,0,13,4,0,13,2,0,20,6,0,10,6,0,21,6,
+0,0,0,2,4,0,2,1,1,0,35,13,2,0,13,6,
+0,28,0,0,18,40,0,11,0,0,13,6,0,20,4,0,
+18,6,0,5,0,0,17,8,0,11,2,0,13,6,0,20,
+4,0,18,12,0,11,4,0,10,6,0,13,6,0,21,6,
+0,17,8,0,11,8,0,13,6,0,21,4,0,17,26,0,
+11,10,0,13,6,0,20,4,0,14,4,0,1,0,0,11,
+12,0,23,0,0,13,4,0,20,6,0,1,0,0,13,4,
+0,22,0,0,0,0,1,7,0,3,1,2,0,11,2,0,
+0,13,4,0,23,0,0,14,8,0,1,0,0,13,8,0,
+13,2,0,25,0,0,13,2,0,26,0,0,21,6,0,0,
+0,1,0,0,2,2,0,0,29,11,0,0,13,2,0,8,
+0,0,20,6,0,14,4,0,1,0,0,13,4,0,18,26,
+0,11,2,0,13,2,0,8,2,0,20,6,0,14,6,0,
+1,0,0,13,6,0,18,6,0,5,0,0,17,4,0,13,
+6,0,17,4,0,13,4,0,18,8,0,2,0,0,22,0,
+0,17,10,0,11,4,0,10,6,0,15,2,0,21,6,0,
+2,92,94,0,0,4,0,3,0,0,0,16,13,4,0,27,
+0,0,18,24,0,15,2,0,11,0,0,13,2,0,15,2,
+2,13,4,0,25,0,0,20,8,0,13,4,0,26,0,0,
+21,6,0,17,6,0,13,2,0,22,0,0,0,0,0,1,
+0,3,6,5,0,37,2,0,0,2,0,0,2,0,0,2,
+0,0,2,0,0,23,0,0,14,26,0,1,0,0,23,2,
+0,14,24,0,1,0,0,23,4,0,14,20,0,1,0,0,
+5,0,0,14,18,0,1,0,0,5,0,0,14,22,0,1,
+0,0,23,6,0,14,18,0,1,0,0,23,8,0,14,22,
+0,1,0,0,5,0,0,14,16,0,1,0,0,23,10,0,
+14,16,0,1,0,0,11,0,0,13,16,0,13,2,0,26,
+0,0,21,6,0,0,0,6,1,0,2,0,0,0,5,13,
+2,0,26,0,0,26,0,0,25,0,0,22,0,0,0,0,
+0,0,0,3,0,0,0,10,11,0,0,11,2,0,11,4,
+0,13,2,0,20,4,0,11,6,0,13,4,0,20,4,0,
+20,6,0,21,4,0,0,0,0,4,0,2,1,0,0,16,
+11,0,0,13,2,0,20,4,0,14,4,0,1,0,0,11,
+2,0,13,4,0,20,4,0,18,12,0,11,4,0,10,6,
+0,13,2,0,21,6,0,17,6,0,13,4,0,22,0,0,
+0,0,0,4,0,2,5,0,0,60,13,2,0,25,0,0,
+14,4,0,1,0,0,11,0,0,13,4,0,10,2,0,20,
+6,0,14,6,0,1,0,0,13,6,0,18,66,0,11,4,
+0,13,4,0,10,6,0,20,6,0,14,8,0,1,0,0,
+13,8,0,18,46,0,11,8,0,13,4,0,10,10,0,20,
+6,0,14,10,0,1,0,0,13,10,0,18,26,0,11,12,
+0,13,4,0,10,14,0,20,6,0,14,12,0,1,0,0,
+13,12,0,18,6,0,5,0,0,17,4,0,13,12,0,17,
+4,0,13,10,0,17,4,0,13,8,0,17,4,0,13,6,
+0,18,20,0,4,0,0,18,8,0,2,0,0,22,0,0,
+17,8,0,15,2,2,13,2,0,21,4,0,17,12,0,15,
+2,0,11,16,0,13,2,0,20,4,0,21,4,0,0,0,
+0,9,0,2,11,4,0,129,1,2,0,0,2,0,0,13,
+2,0,2,0,0,13,30,0,25,0,0,14,4,0,1,0,
+0,11,0,0,13,4,0,10,2,0,20,6,0,14,6,0,
+1,0,0,13,6,0,18,6,0,5,0,0,17,4,0,13,
+6,0,18,194,1,0,11,4,0,13,4,0,10,6,0,20,
+6,0,14,10,0,1,0,0,13,10,0,18,6,0,5,0,
+0,17,4,0,13,10,0,18,130,1,0,11,8,0,13,4,
+0,10,10,0,20,6,0,14,16,0,1,0,0,13,16,0,
+18,6,0,5,0,0,17,4,0,13,16,0,18,82,0,11,
+12,0,13,4,0,10,14,0,20,6,0,14,20,0,1,0,
+0,13,20,0,18,6,0,5,0,0,17,4,0,13,20,0,
+18,30,0,4,0,0,18,8,0,2,0,0,22,0,0,17,
+18,0,11,16,0,23,0,0,11,18,0,15,2,2,13,30,
+0,20,4,0,20,4,0,21,6,0,17,28,0,15,2,4,
+11,20,0,13,30,0,20,4,0,20,4,0,14,22,0,1,
+0,0,23,2,0,14,32,0,1,0,0,13,32,0,13,22,
+0,21,4,0,17,24,0,15,2,4,11,22,0,13,30,0,
+20,4,0,20,4,0,14,18,0,1,0,0,11,24,0,23,
+4,0,13,18,0,21,6,0,17,40,0,15,2,4,11,26,
+0,13,30,0,20,4,0,20,4,0,14,12,0,1,0,0,
+11,28,0,23,6,0,11,30,0,13,30,0,20,4,0,20,
+6,0,14,28,0,1,0,0,11,32,0,23,8,0,13,12,
+0,21,6,0,17,28,0,15,2,4,11,34,0,13,30,0,
+20,4,0,20,4,0,14,26,0,1,0,0,11,36,0,23,
+10,0,11,38,0,13,30,0,20,4,0,21,6,0,0,0,
+6,20,0,2,2,1,0,15,2,0,0,15,2,0,13,2,
+0,20,4,0,14,8,0,1,0,0,15,2,4,13,2,0,
+20,4,0,14,6,0,1,0,0,11,0,0,23,0,0,13,
+6,0,21,6,0,0,0,1,1,0,2,0,0,0,4,13,
+2,0,13,2,0,24,0,0,22,0,0,0,0,0,0,0,
+2,0,0,0,28,13,2,0,27,0,0,18,48,0,11,0,
+0,11,2,0,13,2,0,20,4,0,11,4,0,15,2,4,
+20,4,0,20,6,0,18,20,0,13,2,0,25,0,0,15,
+2,6,13,2,0,26,0,0,20,4,0,24,0,0,22,0,
+0,17,10,0,15,2,6,13,2,0,26,0,0,21,4,0,
+17,6,0,3,0,0,22,0,0,0,0,0,3,0,2,0,
+0,0,11,15,4,6,15,4,8,15,2,4,20,4,0,13,
+2,0,25,0,0,20,6,0,13,2,0,26,0,0,24,0,
+0,22,0,0,0,0,0,0,0,2,0,0,0,12,10,0,
+0,10,2,0,3,0,0,24,0,0,24,0,0,10,4,0,
+10,6,0,3,0,0,24,0,0,24,0,0,24,0,0,22,
+0,0,0,0,0,4,0,2,2,0,0,22,11,0,0,13,
+2,0,25,0,0,15,2,2,20,6,0,14,4,0,1,0,
+0,13,4,0,18,24,0,13,2,0,14,6,0,1,0,0,
+13,6,0,18,8,0,5,0,0,22,0,0,17,6,0,13,
+6,0,22,0,0,17,6,0,13,4,0,22,0,0,0,0,
+0,1,0,2,0,0,0,4,11,0,0,13,2,0,15,2,
+0,21,6,0,0,0,0,1,0,2,0,0,0,7,11,0,
+0,15,2,0,13,2,0,26,0,0,13,2,0,25,0,0,
+21,8,0,0,0,0,1,0,2,0,0,0,4,11,0,0,
+13,2,0,11,2,0,21,6,0,0,0,0,2,0,1,1,
+0,1,3,11,0,0,10,2,0,21,4,0,0,0,0,2,
+0,3,0,0,0,30,13,2,0,26,0,0,27,0,0,18,
+50,0,11,0,0,13,2,0,20,4,0,27,0,0,18,32,
+0,11,2,0,11,4,0,11,6,0,13,2,0,20,4,0,
+11,8,0,10,10,0,20,4,0,11,12,0,13,2,0,20,
+4,0,24,0,0,5,0,0,21,10,0,17,8,0,11,14,
+0,13,2,0,21,4,0,17,6,0,4,0,0,22,0,0,
+0,0,0,8,0,3,1,0,0,41,11,0,0,13,2,0,
+20,4,0,14,6,0,1,0,0,13,6,0,6,0,0,34,
+0,0,18,62,0,13,6,0,6,2,0,34,0,0,18,46,
+0,13,6,0,6,4,0,34,0,0,18,26,0,11,2,0,
+11,4,0,11,6,0,13,2,0,20,4,0,11,8,0,11,
+10,0,13,2,0,20,4,0,24,0,0,21,8,0,17,12,
+0,11,12,0,13,2,0,26,0,0,24,0,0,22,0,0,
+17,8,0,11,14,0,13,2,0,21,4,0,17,6,0,2,
+0,0,22,0,0,3,2,4,6,0,0,8,0,3,0,0,
+0,6,11,0,0,11,2,0,13,2,0,20,4,0,13,4,
+0,21,6,0,0,0,0,2,0,3,4,3,0,40,13,4,
+0,2,0,0,2,0,0,13,2,0,26,0,0,25,0,0,
+14,6,0,1,0,0,13,2,0,26,0,0,26,0,0,14,
+8,0,1,0,0,11,0,0,10,2,0,11,4,0,20,6,
+0,14,16,0,1,0,0,11,6,0,10,8,0,20,4,0,
+13,16,0,13,6,0,3,0,0,24,0,0,24,0,0,3,
+0,0,24,0,0,23,0,0,14,18,0,1,0,0,13,18,
+0,13,8,0,20,4,0,3,0,0,24,0,0,24,0,0,
+24,0,0,22,0,0,0,0,1,5,0,2,1,0,0,89,
+13,2,0,27,0,0,18,170,1,0,13,2,0,25,0,0,
+14,4,0,1,0,0,11,0,0,11,2,0,13,4,0,25,
+0,0,20,4,0,18,6,0,5,0,0,17,22,0,11,4,
+0,11,6,0,10,8,0,20,4,0,11,10,0,13,4,0,
+25,0,0,15,2,0,20,6,0,20,6,0,18,28,0,11,
+12,0,10,14,0,20,4,0,11,16,0,11,18,0,23,0,
+0,13,4,0,25,0,0,20,6,0,3,0,0,20,6,0,
+24,0,0,17,4,0,4,0,0,11,20,0,11,22,0,13,
+4,0,20,4,0,20,4,0,18,6,0,5,0,0,17,24,
+0,11,24,0,11,26,0,10,28,0,20,4,0,11,30,0,
+11,32,0,13,4,0,20,4,0,15,2,0,20,6,0,20,
+6,0,18,18,0,11,34,0,11,36,0,13,4,0,26,0,
+0,3,0,0,20,6,0,24,0,0,17,18,0,13,4,0,
+26,0,0,26,0,0,25,0,0,15,2,2,3,0,0,24,
+0,0,24,0,0,15,2,4,13,2,0,26,0,0,20,4,
+0,3,0,0,24,0,0,24,0,0,24,0,0,24,0,0,
+22,0,0,17,6,0,2,0,0,22,0,0,0,0,1,19,
+0,2,0,0,0,14,11,0,0,10,2,0,20,4,0,15,
+4,2,11,4,0,13,2,0,3,0,0,24,0,0,24,0,
+0,3,0,0,24,0,0,24,0,0,24,0,0,22,0,0,
+0,0,0,3,0,3,4,0,0,143,1,13,2,0,26,0,
+0,14,6,0,1,0,0,13,6,0,27,0,0,18,142,2,
+0,13,6,0,25,0,0,14,8,0,1,0,0,11,0,0,
+13,8,0,25,0,0,20,4,0,18,6,0,5,0,0,17,
+22,0,11,2,0,11,4,0,10,6,0,20,4,0,11,8,
+0,13,8,0,25,0,0,13,4,0,20,6,0,20,6,0,
+18,214,1,0,13,8,0,26,0,0,27,0,0,18,146,1,
+0,11,10,0,11,12,0,13,8,0,20,4,0,20,4,0,
+18,6,0,5,0,0,17,24,0,11,14,0,11,16,0,10,
+18,0,20,4,0,11,20,0,11,22,0,13,8,0,20,4,
+0,13,4,0,20,6,0,20,6,0,18,34,0,11,24,0,
+11,26,0,13,8,0,25,0,0,11,28,0,13,8,0,26,
+0,0,24,0,0,11,30,0,10,32,0,20,4,0,13,6,
+0,26,0,0,24,0,0,21,10,0,17,72,0,11,34,0,
+10,36,0,11,38,0,20,6,0,14,12,0,1,0,0,11,
+40,0,11,42,0,10,44,0,20,4,0,11,46,0,11,48,
+0,13,12,0,13,8,0,25,0,0,20,6,0,20,4,0,
+11,50,0,11,52,0,13,12,0,11,54,0,11,56,0,13,
+8,0,20,4,0,25,0,0,13,12,0,20,6,0,11,58,
+0,10,60,0,20,4,0,13,6,0,26,0,0,24,0,0,
+20,10,0,21,8,0,17,60,0,11,62,0,10,64,0,11,
+66,0,20,6,0,14,10,0,1,0,0,11,68,0,11,70,
+0,10,72,0,20,4,0,11,74,0,11,76,0,13,10,0,
+13,8,0,25,0,0,20,6,0,20,4,0,11,78,0,11,
+80,0,13,10,0,13,10,0,11,82,0,10,84,0,20,4,
+0,13,6,0,26,0,0,24,0,0,20,10,0,21,8,0,
+17,12,0,11,86,0,13,8,0,26,0,0,24,0,0,22,
+0,0,17,6,0,2,0,0,22,0,0,0,0,0,44,0,
+3,1,0,0,62,11,0,0,13,2,0,20,4,0,14,6,
+0,1,0,0,13,6,0,6,0,0,34,0,0,18,100,0,
+11,2,0,11,4,0,13,2,0,20,4,0,20,4,0,18,
+58,0,11,6,0,13,2,0,20,4,0,29,0,0,18,12,
+0,11,8,0,10,10,0,13,2,0,21,6,0,17,36,0,
+11,12,0,11,14,0,11,16,0,13,2,0,20,4,0,25,
+0,0,11,18,0,11,20,0,13,2,0,20,4,0,26,0,
+0,11,22,0,13,2,0,20,4,0,24,0,0,24,0,0,
+21,8,0,17,30,0,13,6,0,6,2,0,34,0,0,18,
+12,0,11,24,0,10,26,0,13,2,0,21,6,0,17,12,
+0,11,28,0,13,2,0,26,0,0,24,0,0,22,0,0,
+17,10,0,11,30,0,10,32,0,13,2,0,21,6,0,2,
+2,6,0,0,17,0,3,1,0,0,27,11,0,0,10,2,
+0,11,4,0,11,6,0,13,2,0,20,4,0,20,4,0,
+10,8,0,20,8,0,14,6,0,1,0,0,11,10,0,11,
+12,0,11,14,0,13,2,0,20,4,0,11,16,0,11,18,
+0,10,20,0,11,22,0,11,24,0,10,26,0,20,4,0,
+13,6,0,20,6,0,20,8,0,21,8,0,0,0,0,14,
+0,3,0,0,0,27,11,0,0,13,2,0,20,4,0,6,
+0,0,34,0,0,18,12,0,11,2,0,10,4,0,13,2,
+0,21,6,0,17,34,0,11,6,0,11,8,0,13,2,0,
+20,4,0,20,4,0,18,12,0,11,10,0,10,12,0,13,
+2,0,21,6,0,17,12,0,11,14,0,13,2,0,26,0,
+0,24,0,0,22,0,0,1,6,0,0,8,0,3,2,0,
+0,52,13,2,0,26,0,0,25,0,0,14,6,0,1,0,
+0,13,2,0,26,0,0,26,0,0,14,8,0,1,0,0,
+13,6,0,29,0,0,18,42,0,11,0,0,13,6,0,11,
+2,0,10,4,0,20,4,0,11,6,0,11,8,0,13,8,
+0,3,0,0,20,6,0,24,0,0,3,0,0,24,0,0,
+24,0,0,3,0,0,24,0,0,24,0,0,24,0,0,22,
+0,0,17,40,0,11,10,0,10,12,0,20,4,0,13,6,
+0,25,0,0,11,14,0,13,6,0,26,0,0,11,16,0,
+13,8,0,3,0,0,20,6,0,24,0,0,24,0,0,3,
+0,0,24,0,0,24,0,0,24,0,0,22,0,0,0,0,
+0,9,0,3,5,2,0,60,2,0,0,2,0,0,13,2,
+0,26,0,0,25,0,0,14,6,0,1,0,0,13,2,0,
+26,0,0,26,0,0,14,8,0,1,0,0,11,0,0,10,
+2,0,11,4,0,20,6,0,14,10,0,1,0,0,11,6,
+0,11,8,0,23,0,0,14,16,0,1,0,0,13,16,0,
+13,6,0,20,4,0,11,10,0,10,12,0,20,4,0,11,
+14,0,3,0,0,11,16,0,13,8,0,3,0,0,20,6,
+0,24,0,0,24,0,0,11,18,0,13,10,0,11,20,0,
+23,2,0,14,18,0,1,0,0,13,18,0,13,6,0,13,
+10,0,20,6,0,3,0,0,20,6,0,24,0,0,24,0,
+0,3,0,0,24,0,0,24,0,0,24,0,0,3,0,0,
+24,0,0,20,6,0,24,0,0,22,0,0,0,0,2,11,
+0,2,0,0,0,38,13,2,0,29,0,0,18,38,0,11,
+0,0,13,2,0,20,4,0,18,8,0,3,0,0,22,0,
+0,17,22,0,11,2,0,13,2,0,2,0,0,3,0,0,
+24,0,0,24,0,0,24,0,0,3,0,0,24,0,0,22,
+0,0,17,36,0,11,4,0,13,2,0,25,0,0,2,0,
+0,3,0,0,24,0,0,24,0,0,24,0,0,11,6,0,
+15,2,0,13,2,0,26,0,0,20,4,0,3,0,0,20,
+6,0,24,0,0,22,0,0,0,0,0,4,0,3,0,0,
+0,51,13,2,0,29,0,0,18,38,0,11,0,0,13,2,
+0,20,4,0,18,8,0,3,0,0,22,0,0,17,22,0,
+11,2,0,13,2,0,13,4,0,3,0,0,24,0,0,24,
+0,0,24,0,0,3,0,0,24,0,0,22,0,0,17,62,
+0,11,4,0,13,2,0,25,0,0,11,6,0,10,8,0,
+20,4,0,13,4,0,3,0,0,24,0,0,24,0,0,3,
+0,0,24,0,0,24,0,0,24,0,0,11,10,0,15,2,
+2,13,2,0,26,0,0,11,12,0,10,14,0,20,4,0,
+13,4,0,3,0,0,24,0,0,24,0,0,20,6,0,3,
+0,0,20,6,0,24,0,0,22,0,0,0,0,0,8,0,
+3,5,0,0,74,13,2,0,26,0,0,25,0,0,14,6,
+0,1,0,0,13,2,0,26,0,0,26,0,0,25,0,0,
+25,0,0,14,8,0,1,0,0,13,2,0,26,0,0,26,
+0,0,25,0,0,26,0,0,14,10,0,1,0,0,13,2,
+0,26,0,0,26,0,0,26,0,0,14,12,0,1,0,0,
+11,0,0,10,2,0,11,4,0,20,6,0,14,14,0,1,
+0,0,11,6,0,10,8,0,20,4,0,13,14,0,11,10,
+0,23,0,0,13,6,0,20,6,0,11,12,0,13,8,0,
+11,14,0,11,16,0,13,10,0,3,0,0,20,6,0,24,
+0,0,11,18,0,11,20,0,13,12,0,13,14,0,11,22,
+0,11,24,0,23,2,0,13,6,0,20,6,0,3,0,0,
+20,6,0,24,0,0,3,0,0,24,0,0,20,6,0,24,
+0,0,3,0,0,24,0,0,24,0,0,24,0,0,24,0,
+0,3,0,0,24,0,0,24,0,0,24,0,0,24,0,0,
+22,0,0,0,0,2,13,0,2,0,0,0,9,13,2,0,
+25,0,0,11,0,0,13,2,0,20,4,0,3,0,0,24,
+0,0,24,0,0,22,0,0,0,0,0,1,0,2,0,0,
+0,14,13,2,0,26,0,0,26,0,0,27,0,0,18,14,
+0,13,2,0,26,0,0,26,0,0,25,0,0,22,0,0,
+17,8,0,13,2,0,25,0,0,22,0,0,0,0,0,0,
+0,1,1,0,1,3,11,0,0,10,2,0,21,4,0,0,
+0,0,2,0,3,1,0,0,36,11,0,0,13,2,0,20,
+4,0,14,6,0,1,0,0,13,6,0,6,0,0,34,0,
+0,18,46,0,13,6,0,6,2,0,34,0,0,18,12,0,
+11,2,0,10,4,0,13,2,0,21,6,0,17,26,0,11,
+6,0,11,8,0,11,10,0,13,2,0,6,4,0,20,6,
+0,11,12,0,13,2,0,6,6,0,20,6,0,2,0,0,
+21,10,0,17,12,0,11,14,0,13,2,0,26,0,0,24,
+0,0,22,0,0,4,8,6,2,4,0,0,8,0,3,0,
+0,0,33,11,0,0,13,2,0,20,4,0,6,0,0,34,
+0,0,18,48,0,11,2,0,11,4,0,13,2,0,20,4,
+0,20,4,0,18,12,0,11,6,0,10,8,0,13,2,0,
+21,6,0,17,24,0,11,10,0,11,12,0,11,14,0,13,
+2,0,20,4,0,11,16,0,11,18,0,13,2,0,20,4,
+0,24,0,0,21,8,0,17,10,0,11,20,0,10,22,0,
+13,2,0,21,6,0,1,2,0,0,12,0,2,0,1,0,
+3,13,2,0,23,0,0,22,0,0,0,0,1,0,0,3,
+6,4,0,44,2,0,0,13,4,0,2,0,0,2,0,0,
+11,0,0,20,2,0,14,18,0,1,0,0,11,2,0,20,
+2,0,14,22,0,1,0,0,5,0,0,14,10,0,1,0,
+0,5,0,0,14,12,0,1,0,0,5,0,0,14,24,0,
+1,0,0,23,0,0,14,10,0,1,0,0,23,2,0,14,
+12,0,1,0,0,23,4,0,14,24,0,1,0,0,13,2,
+0,26,0,0,14,16,0,1,0,0,13,24,0,13,12,0,
+11,4,0,15,2,0,13,24,0,13,10,0,13,16,0,20,
+6,0,20,6,0,21,6,0,0,0,3,3,0,2,2,0,
+0,29,15,2,0,13,2,0,20,4,0,14,4,0,1,0,
+0,13,4,0,18,40,0,11,0,0,13,2,0,15,2,2,
+20,6,0,14,6,0,1,0,0,15,2,0,13,2,0,13,
+6,0,20,6,0,1,0,0,15,2,4,13,6,0,13,2,
+0,20,6,0,1,0,0,13,6,0,22,0,0,17,8,0,
+13,4,0,26,0,0,22,0,0,0,0,0,1,0,2,1,
+0,0,13,15,2,4,13,2,0,20,4,0,14,4,0,1,
+0,0,13,4,0,18,8,0,13,2,0,22,0,0,17,8,
+0,13,4,0,26,0,0,22,0,0,0,0,0,0,0,3,
+0,0,0,39,11,0,0,13,4,0,20,4,0,18,66,0,
+13,4,0,29,0,0,18,34,0,11,2,0,13,4,0,20,
+4,0,18,8,0,13,4,0,22,0,0,17,18,0,11,4,
+0,15,2,6,13,2,0,11,6,0,13,4,0,20,4,0,
+20,6,0,21,4,0,17,26,0,15,2,6,13,2,0,13,
+4,0,25,0,0,20,6,0,15,2,6,13,2,0,13,4,
+0,26,0,0,20,6,0,24,0,0,22,0,0,17,8,0,
+13,2,0,13,4,0,21,4,0,0,0,0,4,0,3,0,
+0,0,64,11,0,0,11,2,0,13,2,0,20,4,0,20,
+4,0,18,44,0,11,4,0,11,6,0,11,8,0,11,10,
+0,13,2,0,20,4,0,20,6,0,11,12,0,13,2,0,
+20,4,0,24,0,0,24,0,0,11,14,0,11,16,0,11,
+18,0,13,2,0,20,4,0,20,6,0,24,0,0,22,0,
+0,17,76,0,11,20,0,11,22,0,11,24,0,3,0,0,
+11,26,0,11,28,0,11,30,0,13,2,0,20,4,0,11,
+32,0,11,34,0,11,36,0,11,38,0,13,2,0,20,4,
+0,25,0,0,20,6,0,11,40,0,13,2,0,20,4,0,
+26,0,0,24,0,0,24,0,0,20,8,0,11,42,0,13,
+2,0,20,4,0,11,44,0,11,46,0,11,48,0,13,2,
+0,20,4,0,25,0,0,20,6,0,24,0,0,20,10,0,
+21,4,0,0,0,0,25,0,3,2,0,0,59,13,2,0,
+26,0,0,25,0,0,14,6,0,1,0,0,13,2,0,26,
+0,0,26,0,0,14,8,0,1,0,0,13,6,0,27,0,
+0,18,72,0,11,0,0,10,2,0,20,4,0,13,6,0,
+25,0,0,25,0,0,11,4,0,13,6,0,25,0,0,26,
+0,0,3,0,0,20,6,0,24,0,0,3,0,0,24,0,
+0,11,6,0,10,8,0,20,4,0,11,10,0,13,6,0,
+26,0,0,3,0,0,20,6,0,11,12,0,13,8,0,3,
+0,0,20,6,0,24,0,0,24,0,0,3,0,0,24,0,
+0,24,0,0,24,0,0,22,0,0,17,24,0,11,14,0,
+10,16,0,20,4,0,3,0,0,11,18,0,13,8,0,3,
+0,0,20,6,0,24,0,0,24,0,0,22,0,0,0,0,
+0,10,0,3,2,0,0,70,13,2,0,26,0,0,25,0,
+0,14,6,0,1,0,0,13,2,0,26,0,0,26,0,0,
+14,8,0,1,0,0,13,6,0,27,0,0,18,94,0,11,
+0,0,10,2,0,20,4,0,11,4,0,3,0,0,11,6,
+0,13,6,0,25,0,0,26,0,0,3,0,0,20,6,0,
+24,0,0,24,0,0,11,8,0,10,10,0,20,4,0,11,
+12,0,13,6,0,25,0,0,25,0,0,3,0,0,20,6,
+0,11,14,0,10,16,0,20,4,0,11,18,0,13,6,0,
+26,0,0,3,0,0,20,6,0,11,20,0,13,8,0,3,
+0,0,20,6,0,24,0,0,24,0,0,3,0,0,24,0,
+0,24,0,0,24,0,0,3,0,0,24,0,0,24,0,0,
+24,0,0,22,0,0,17,24,0,11,22,0,10,24,0,20,
+4,0,3,0,0,11,26,0,13,8,0,3,0,0,20,6,
+0,24,0,0,24,0,0,22,0,0,0,0,0,14,0,3,
+0,0,0,10,11,0,0,10,2,0,20,4,0,11,4,0,
+13,2,0,26,0,0,3,0,0,20,6,0,24,0,0,22,
+0,0,0,0,0,3,0,3,0,0,0,10,11,0,0,10,
+2,0,20,4,0,11,4,0,13,2,0,26,0,0,3,0,
+0,20,6,0,24,0,0,22,0,0,0,0,0,3,0,3,
+0,0,0,10,11,0,0,10,2,0,20,4,0,11,4,0,
+13,2,0,26,0,0,3,0,0,20,6,0,24,0,0,22,
+0,0,0,0,0,3,0,3,4,0,0,42,13,2,0,26,
+0,0,25,0,0,14,6,0,1,0,0,13,2,0,26,0,
+0,26,0,0,14,8,0,1,0,0,11,0,0,23,0,0,
+11,2,0,11,4,0,13,6,0,20,6,0,20,6,0,14,
+10,0,1,0,0,11,6,0,23,2,0,13,6,0,20,6,
+0,14,12,0,1,0,0,11,8,0,10,10,0,20,4,0,
+11,12,0,13,10,0,3,0,0,20,6,0,11,14,0,13,
+12,0,11,16,0,13,8,0,3,0,0,20,6,0,20,6,
+0,24,0,0,24,0,0,22,0,0,0,0,2,9,0,2,
+0,0,0,6,13,2,0,5,0,0,3,0,0,24,0,0,
+24,0,0,22,0,0,0,0,0,0,0,2,0,0,0,9,
+11,0,0,10,2,0,20,4,0,11,4,0,13,2,0,3,
+0,0,20,6,0,24,0,0,22,0,0,0,0,0,3,0,
+3,2,0,0,25,13,2,0,26,0,0,25,0,0,14,6,
+0,1,0,0,13,2,0,26,0,0,26,0,0,14,8,0,
+1,0,0,10,0,0,3,0,0,11,2,0,11,4,0,23,
+0,0,13,6,0,20,6,0,11,6,0,13,8,0,3,0,
+0,20,6,0,20,6,0,24,0,0,24,0,0,22,0,0,
+0,0,1,4,0,2,0,0,0,13,11,0,0,10,2,0,
+20,4,0,13,2,0,25,0,0,11,4,0,13,2,0,20,
+4,0,3,0,0,24,0,0,24,0,0,24,0,0,22,0,
+0,0,0,0,3,0,3,1,0,0,38,13,2,0,26,0,
+0,27,0,0,18,66,0,11,0,0,10,2,0,13,4,0,
+20,6,0,14,6,0,1,0,0,11,4,0,11,6,0,10,
+8,0,20,4,0,11,10,0,11,12,0,13,6,0,11,14,
+0,13,2,0,20,4,0,20,6,0,20,4,0,11,16,0,
+11,18,0,13,6,0,13,6,0,11,20,0,10,22,0,20,
+4,0,11,24,0,13,2,0,20,4,0,24,0,0,20,10,
+0,21,8,0,17,6,0,5,0,0,22,0,0,0,0,0,
+13,0,3,3,0,0,56,13,2,0,26,0,0,25,0,0,
+14,6,0,1,0,0,13,2,0,26,0,0,26,0,0,14,
+8,0,1,0,0,13,6,0,27,0,0,18,74,0,13,6,
+0,25,0,0,14,10,0,1,0,0,11,0,0,10,2,0,
+20,4,0,13,10,0,25,0,0,11,4,0,13,10,0,20,
+4,0,11,6,0,3,0,0,11,8,0,10,10,0,20,4,
+0,13,6,0,26,0,0,11,12,0,13,8,0,3,0,0,
+20,6,0,24,0,0,24,0,0,3,0,0,24,0,0,24,
+0,0,24,0,0,3,0,0,24,0,0,24,0,0,24,0,
+0,24,0,0,22,0,0,17,16,0,11,14,0,11,16,0,
+13,8,0,3,0,0,20,6,0,24,0,0,22,0,0,0,
+0,0,9,0,3,5,5,0,26,13,4,0,2,0,0,2,
+0,0,2,0,0,2,0,0,23,0,0,14,24,0,1,0,
+0,23,2,0,14,18,0,1,0,0,23,4,0,14,22,0,
+1,0,0,23,6,0,14,20,0,1,0,0,11,0,0,13,
+2,0,20,4,0,14,14,0,1,0,0,13,20,0,6,0,
+0,13,14,0,21,6,0,1,2,0,4,1,0,2,0,0,
+0,24,13,2,0,29,0,0,18,8,0,5,0,0,22,0,
+0,17,38,0,11,0,0,13,2,0,25,0,0,20,4,0,
+18,8,0,5,0,0,22,0,0,17,22,0,11,2,0,11,
+4,0,10,6,0,20,4,0,11,8,0,13,2,0,25,0,
+0,15,2,0,20,6,0,21,6,0,0,0,0,5,0,2,
+0,0,0,24,13,2,0,29,0,0,18,8,0,5,0,0,
+22,0,0,17,38,0,11,0,0,13,2,0,25,0,0,20,
+4,0,18,8,0,5,0,0,22,0,0,17,22,0,11,2,
+0,11,4,0,10,6,0,20,4,0,11,8,0,13,2,0,
+25,0,0,15,2,0,20,6,0,21,6,0,0,0,0,5,
+0,2,0,0,0,33,13,2,0,29,0,0,18,8,0,5,
+0,0,22,0,0,17,56,0,13,2,0,25,0,0,29,0,
+0,18,8,0,5,0,0,22,0,0,17,42,0,11,0,0,
+11,2,0,13,2,0,20,4,0,20,4,0,18,8,0,5,
+0,0,22,0,0,17,24,0,11,4,0,11,6,0,10,8,
+0,20,4,0,11,10,0,11,12,0,13,2,0,20,4,0,
+15,2,0,20,6,0,21,6,0,0,0,0,7,0,3,0,
+0,0,158,1,15,2,2,13,4,0,20,4,0,18,250,1,
+0,15,2,6,13,4,0,20,4,0,18,138,1,0,15,2,
+8,13,4,0,20,4,0,18,86,0,13,4,0,29,0,0,
+18,48,0,11,0,0,13,4,0,20,4,0,18,16,0,11,
+2,0,11,4,0,10,6,0,20,4,0,13,4,0,21,6,
+0,17,24,0,11,8,0,11,10,0,10,12,0,20,4,0,
+15,2,4,13,2,0,11,14,0,13,4,0,20,4,0,20,
+6,0,21,6,0,17,32,0,11,16,0,11,18,0,10,20,
+0,20,4,0,15,2,4,13,2,0,13,4,0,25,0,0,
+20,6,0,15,2,4,13,2,0,13,4,0,26,0,0,20,
+6,0,21,8,0,17,44,0,11,22,0,11,24,0,10,26,
+0,20,4,0,11,28,0,11,30,0,10,32,0,20,4,0,
+11,34,0,10,36,0,20,4,0,20,6,0,15,2,4,13,
+2,0,6,0,0,30,0,0,13,4,0,26,0,0,25,0,
+0,20,6,0,21,8,0,17,104,0,13,2,0,6,2,0,
+34,0,0,18,68,0,11,38,0,11,40,0,10,42,0,20,
+4,0,11,44,0,11,46,0,10,48,0,20,4,0,11,50,
+0,11,52,0,10,54,0,20,4,0,11,56,0,10,58,0,
+20,4,0,20,6,0,15,2,4,13,2,0,6,4,0,31,
+0,0,13,4,0,25,0,0,26,0,0,25,0,0,20,6,
+0,20,8,0,15,2,4,13,2,0,13,4,0,26,0,0,
+20,6,0,21,8,0,17,30,0,11,60,0,11,62,0,10,
+64,0,20,4,0,13,4,0,25,0,0,26,0,0,25,0,
+0,15,2,4,13,2,0,13,4,0,26,0,0,20,6,0,
+21,8,0,17,62,0,13,2,0,6,6,0,34,0,0,18,
+46,0,11,66,0,11,68,0,10,70,0,20,4,0,11,72,
+0,11,74,0,10,76,0,20,4,0,11,78,0,10,80,0,
+20,4,0,20,6,0,15,2,4,13,2,0,6,8,0,31,
+0,0,13,4,0,26,0,0,25,0,0,20,6,0,21,8,
+0,17,10,0,13,4,0,26,0,0,25,0,0,22,0,0,
+5,2,2,2,2,2,0,0,41,0,3,0,0,0,17,11,
+0,0,13,2,0,20,4,0,6,0,0,34,0,0,18,12,
+0,11,2,0,10,4,0,13,2,0,21,6,0,17,14,0,
+11,6,0,11,8,0,11,10,0,13,2,0,20,4,0,21,
+6,0,1,4,0,0,6,0,3,0,0,0,27,11,0,0,
+13,2,0,20,4,0,6,0,0,34,0,0,18,12,0,11,
+2,0,10,4,0,13,2,0,21,6,0,17,34,0,11,6,
+0,11,8,0,13,2,0,20,4,0,20,4,0,18,12,0,
+11,10,0,10,12,0,13,2,0,21,6,0,17,12,0,11,
+14,0,13,2,0,26,0,0,24,0,0,22,0,0,1,6,
+0,0,8,0,3,0,0,0,5,11,0,0,11,2,0,13,
+2,0,26,0,0,21,6,0,0,0,0,2,0,3,7,7,
+0,49,2,0,0,13,4,0,2,0,0,2,0,0,2,0,
+0,2,0,0,2,0,0,3,0,0,14,20,0,1,0,0,
+5,0,0,14,24,0,1,0,0,23,0,0,14,24,0,1,
+0,0,23,2,0,14,32,0,1,0,0,23,4,0,14,26,
+0,1,0,0,23,6,0,14,30,0,1,0,0,23,8,0,
+14,28,0,1,0,0,13,28,0,6,0,0,11,0,0,13,
+2,0,20,4,0,20,6,0,14,18,0,1,0,0,11,2,
+0,10,4,0,20,4,0,11,6,0,11,8,0,13,20,0,
+20,6,0,13,18,0,3,0,0,24,0,0,24,0,0,24,
+0,0,22,0,0,1,2,0,5,5,0,2,1,0,0,45,
+11,0,0,13,2,0,15,2,0,20,6,0,14,4,0,1,
+0,0,13,4,0,18,70,0,13,2,0,11,2,0,13,2,
+0,15,2,2,20,6,0,11,4,0,10,6,0,20,4,0,
+10,8,0,13,2,0,3,0,0,24,0,0,24,0,0,10,
+10,0,15,2,2,3,0,0,24,0,0,24,0,0,3,0,
+0,24,0,0,24,0,0,24,0,0,3,0,0,24,0,0,
+24,0,0,24,0,0,15,2,0,24,0,0,16,2,0,1,
+0,0,15,2,4,13,2,0,21,4,0,17,8,0,11,12,
+0,13,4,0,21,4,0,0,0,0,7,0,2,0,0,0,
+24,13,2,0,29,0,0,18,8,0,5,0,0,22,0,0,
+17,38,0,11,0,0,13,2,0,25,0,0,20,4,0,18,
+8,0,5,0,0,22,0,0,17,22,0,11,2,0,11,4,
+0,10,6,0,20,4,0,11,8,0,13,2,0,25,0,0,
+15,2,2,20,6,0,21,6,0,0,0,0,5,0,2,0,
+0,0,24,13,2,0,29,0,0,18,8,0,5,0,0,22,
+0,0,17,38,0,11,0,0,13,2,0,25,0,0,20,4,
+0,18,8,0,5,0,0,22,0,0,17,22,0,11,2,0,
+11,4,0,10,6,0,20,4,0,11,8,0,13,2,0,25,
+0,0,15,2,2,20,6,0,21,6,0,0,0,0,5,0,
+2,0,0,0,33,13,2,0,29,0,0,18,8,0,5,0,
+0,22,0,0,17,56,0,13,2,0,25,0,0,29,0,0,
+18,8,0,5,0,0,22,0,0,17,42,0,11,0,0,11,
+2,0,13,2,0,20,4,0,20,4,0,18,8,0,5,0,
+0,22,0,0,17,24,0,11,4,0,11,6,0,10,8,0,
+20,4,0,11,10,0,11,12,0,13,2,0,20,4,0,15,
+2,2,20,6,0,21,6,0,0,0,0,7,0,3,0,0,
+0,166,1,15,2,6,13,4,0,20,4,0,18,138,2,0,
+15,2,10,13,4,0,20,4,0,18,154,1,0,15,2,12,
+13,4,0,20,4,0,18,102,0,13,4,0,29,0,0,18,
+64,0,11,0,0,13,4,0,20,4,0,18,32,0,11,2,
+0,13,4,0,20,4,0,18,16,0,11,4,0,11,6,0,
+10,8,0,20,4,0,13,4,0,21,6,0,17,8,0,15,
+2,4,13,4,0,21,4,0,17,24,0,11,10,0,11,12,
+0,10,14,0,20,4,0,15,2,8,13,2,0,11,16,0,
+13,4,0,20,4,0,20,6,0,21,6,0,17,32,0,11,
+18,0,11,20,0,10,22,0,20,4,0,15,2,8,13,2,
+0,13,4,0,25,0,0,20,6,0,15,2,8,13,2,0,
+13,4,0,26,0,0,20,6,0,21,8,0,17,44,0,11,
+24,0,11,26,0,10,28,0,20,4,0,11,30,0,11,32,
+0,10,34,0,20,4,0,11,36,0,10,38,0,20,4,0,
+20,6,0,15,2,8,13,2,0,6,0,0,30,0,0,13,
+4,0,26,0,0,25,0,0,20,6,0,21,8,0,17,104,
+0,13,2,0,6,2,0,34,0,0,18,68,0,11,40,0,
+11,42,0,10,44,0,20,4,0,11,46,0,11,48,0,10,
+50,0,20,4,0,11,52,0,11,54,0,10,56,0,20,4,
+0,11,58,0,10,60,0,20,4,0,20,6,0,15,2,8,
+13,2,0,6,4,0,31,0,0,13,4,0,25,0,0,26,
+0,0,25,0,0,20,6,0,20,8,0,15,2,8,13,2,
+0,13,4,0,26,0,0,20,6,0,21,8,0,17,30,0,
+11,62,0,11,64,0,10,66,0,20,4,0,13,4,0,25,
+0,0,26,0,0,25,0,0,15,2,8,13,2,0,13,4,
+0,26,0,0,20,6,0,21,8,0,17,62,0,13,2,0,
+6,6,0,34,0,0,18,46,0,11,68,0,11,70,0,10,
+72,0,20,4,0,11,74,0,11,76,0,10,78,0,20,4,
+0,11,80,0,10,82,0,20,4,0,20,6,0,15,2,8,
+13,2,0,6,8,0,31,0,0,13,4,0,26,0,0,25,
+0,0,20,6,0,21,8,0,17,10,0,13,4,0,26,0,
+0,25,0,0,22,0,0,5,2,2,2,2,2,0,0,42,
+0,3,4,3,0,39,2,0,0,13,4,0,2,0,0,3,
+0,0,14,14,0,1,0,0,5,0,0,14,18,0,1,0,
+0,5,0,0,14,10,0,1,0,0,23,0,0,14,18,0,
+1,0,0,23,2,0,14,10,0,1,0,0,13,10,0,13,
+18,0,11,0,0,13,2,0,20,4,0,20,6,0,14,12,
+0,1,0,0,11,2,0,10,4,0,20,4,0,11,6,0,
+11,8,0,13,14,0,20,6,0,13,12,0,3,0,0,24,
+0,0,24,0,0,24,0,0,22,0,0,0,0,2,5,0,
+2,1,0,0,45,11,0,0,13,2,0,15,2,0,20,6,
+0,14,4,0,1,0,0,13,4,0,18,70,0,13,2,0,
+11,2,0,13,2,0,15,2,2,20,6,0,11,4,0,10,
+6,0,20,4,0,10,8,0,13,2,0,3,0,0,24,0,
+0,24,0,0,10,10,0,15,2,2,3,0,0,24,0,0,
+24,0,0,3,0,0,24,0,0,24,0,0,24,0,0,3,
+0,0,24,0,0,24,0,0,24,0,0,15,2,0,24,0,
+0,16,2,0,1,0,0,15,2,4,13,2,0,21,4,0,
+17,8,0,11,12,0,13,4,0,21,4,0,0,0,0,7,
+0,3,0,0,0,73,11,0,0,13,4,0,20,4,0,18,
+134,1,0,13,4,0,29,0,0,18,66,0,11,2,0,13,
+4,0,20,4,0,18,20,0,11,4,0,10,6,0,20,4,
+0,13,4,0,3,0,0,24,0,0,24,0,0,22,0,0,
+17,38,0,11,8,0,10,10,0,20,4,0,10,12,0,10,
+14,0,10,16,0,10,18,0,3,0,0,24,0,0,24,0,
+0,3,0,0,24,0,0,24,0,0,24,0,0,3,0,0,
+24,0,0,24,0,0,22,0,0,17,62,0,11,20,0,10,
+22,0,20,4,0,10,24,0,10,26,0,10,28,0,10,30,
+0,3,0,0,24,0,0,24,0,0,3,0,0,24,0,0,
+24,0,0,24,0,0,10,32,0,10,34,0,10,36,0,10,
+38,0,3,0,0,24,0,0,24,0,0,3,0,0,24,0,
+0,24,0,0,24,0,0,3,0,0,24,0,0,24,0,0,
+24,0,0,22,0,0,17,8,0,13,2,0,13,4,0,21,
+4,0,0,0,0,20,0,1,1,0,1,3,11,0,0,10,
+2,0,21,4,0,0,0,0,2,0,1,1,0,1,3,11,
+0,0,10,2,0,21,4,0,0,0,0,2,0,3,2,0,
+0,25,13,2,0,26,0,0,25,0,0,14,6,0,1,0,
+0,13,2,0,26,0,0,26,0,0,14,8,0,1,0,0,
+11,0,0,13,6,0,2,0,0,11,2,0,11,4,0,13,
+8,0,3,0,0,20,6,0,24,0,0,3,0,0,24,0,
+0,24,0,0,24,0,0,24,0,0,22,0,0,0,0,0,
+3,0,1,1,0,1,3,11,0,0,10,2,0,21,4,0,
+0,0,0,2,0,1,1,0,1,3,11,0,0,10,2,0,
+21,4,0,0,0,0,2,0,3,2,0,0,25,13,2,0,
+26,0,0,25,0,0,14,6,0,1,0,0,13,2,0,26,
+0,0,26,0,0,14,8,0,1,0,0,11,0,0,13,6,
+0,11,2,0,11,4,0,13,8,0,3,0,0,20,6,0,
+24,0,0,2,0,0,3,0,0,24,0,0,24,0,0,24,
+0,0,24,0,0,22,0,0,0,0,0,3,7,3,6,6,
+6,7,3,6,6,6,6,6,3,11,112,105,99,114,105,110,
+46,98,97,115,101,6,11,7,3,2,3,101,110,118,9,11,
+112,105,99,114,105,110,46,98,97,115,101,6,6,1,11,99,
+111,110,100,45,101,120,112,97,110,100,14,0,6,6,6,6,
+1,1,42,1,1,43,1,1,45,1,1,47,1,1,60,1,
+2,60,61,1,1,61,1,2,61,62,1,1,62,1,2,62,
+61,1,17,97,108,105,115,116,45,62,100,105,99,116,105,111,
+110,97,114,121,1,3,97,110,100,1,6,97,112,112,101,110,
+100,1,5,97,112,112,108,121,1,5,97,115,115,111,99,1,
+4,97,115,115,113,1,4,97,115,115,118,1,5,98,101,103,
+105,110,1,9,98,111,111,108,101,97,110,61,63,1,8,98,
+111,111,108,101,97,110,63,1,10,98,121,116,101,118,101,99,
+116,111,114,1,21,98,121,116,101,118,101,99,116,111,114,45,
+62,102,51,50,118,101,99,116,111,114,1,21,98,121,116,101,
+118,101,99,116,111,114,45,62,102,54,52,118,101,99,116,111,
+114,1,16,98,121,116,101,118,101,99,116,111,114,45,62,108,
+105,115,116,1,21,98,121,116,101,118,101,99,116,111,114,45,
+62,115,51,50,118,101,99,116,111,114,1,21,98,121,116,101,
+118,101,99,116,111,114,45,62,115,54,52,118,101,99,116,111,
+114,1,21,98,121,116,101,118,101,99,116,111,114,45,62,117,
+51,50,118,101,99,116,111,114,1,17,98,121,116,101,118,101,
+99,116,111,114,45,97,112,112,101,110,100,1,15,98,121,116,
+101,118,101,99,116,111,114,45,99,111,112,121,1,16,98,121,
+116,101,118,101,99,116,111,114,45,99,111,112,121,33,1,17,
+98,121,116,101,118,101,99,116,111,114,45,108,101,110,103,116,
+104,1,17,98,121,116,101,118,101,99,116,111,114,45,117,56,
+45,114,101,102,1,18,98,121,116,101,118,101,99,116,111,114,
+45,117,56,45,115,101,116,33,1,11,98,121,116,101,118,101,
+99,116,111,114,63,1,4,99,97,97,114,1,4,99,97,100,
+114,1,30,99,97,108,108,45,119,105,116,104,45,99,117,114,
+114,101,110,116,45,99,111,110,116,105,110,117,97,116,105,111,
+110,1,16,99,97,108,108,45,119,105,116,104,45,118,97,108,
+117,101,115,1,7,99,97,108,108,47,99,99,1,3,99,97,
+114,1,4,99,97,115,101,1,4,99,100,97,114,1,4,99,
+100,100,114,1,3,99,100,114,1,13,99,104,97,114,45,62,
+105,110,116,101,103,101,114,1,7,99,104,97,114,60,61,63,
+1,6,99,104,97,114,60,63,1,6,99,104,97,114,61,63,
+1,7,99,104,97,114,62,61,63,1,6,99,104,97,114,62,
+63,1,5,99,104,97,114,63,1,10,99,108,111,115,101,45,
+112,111,114,116,1,4,99,111,110,100,1,4,99,111,110,115,
+1,18,99,117,114,114,101,110,116,45,101,114,114,111,114,45,
+112,111,114,116,1,26,99,117,114,114,101,110,116,45,101,120,
+99,101,112,116,105,111,110,45,104,97,110,100,108,101,114,115,
+1,18,99,117,114,114,101,110,116,45,105,110,112,117,116,45,
+112,111,114,116,1,15,99,117,114,114,101,110,116,45,108,105,
+98,114,97,114,121,1,19,99,117,114,114,101,110,116,45,111,
+117,116,112,117,116,45,112,111,114,116,1,6,100,101,102,105,
+110,101,1,12,100,101,102,105,110,101,45,109,97,99,114,111,
+1,13,100,101,102,105,110,101,45,115,121,110,116,97,120,1,
+13,100,101,102,105,110,101,45,118,97,108,117,101,115,1,10,
+100,105,99,116,105,111,110,97,114,121,1,17,100,105,99,116,
+105,111,110,97,114,121,45,62,97,108,105,115,116,1,17,100,
+105,99,116,105,111,110,97,114,121,45,62,112,108,105,115,116,
+1,19,100,105,99,116,105,111,110,97,114,121,45,102,111,114,
+45,101,97,99,104,1,14,100,105,99,116,105,111,110,97,114,
+121,45,109,97,112,1,14,100,105,99,116,105,111,110,97,114,
+121,45,114,101,102,1,15,100,105,99,116,105,111,110,97,114,
+121,45,115,101,116,33,1,15,100,105,99,116,105,111,110,97,
+114,121,45,115,105,122,101,1,11,100,105,99,116,105,111,110,
+97,114,121,63,1,7,100,105,115,112,108,97,121,1,2,100,
+111,1,12,100,121,110,97,109,105,99,45,98,105,110,100,1,
+12,100,121,110,97,109,105,99,45,119,105,110,100,1,4,101,
+108,115,101,1,10,101,111,102,45,111,98,106,101,99,116,1,
+11,101,111,102,45,111,98,106,101,99,116,63,1,3,101,113,
+63,1,6,101,113,117,97,108,63,1,4,101,113,118,63,1,
+5,101,114,114,111,114,1,22,101,114,114,111,114,45,111,98,
+106,101,99,116,45,105,114,114,105,116,97,110,116,115,1,20,
+101,114,114,111,114,45,111,98,106,101,99,116,45,109,101,115,
+115,97,103,101,1,17,101,114,114,111,114,45,111,98,106,101,
+99,116,45,116,121,112,101,1,13,101,114,114,111,114,45,111,
+98,106,101,99,116,63,1,6,101,115,99,97,112,101,1,4,
+101,118,97,108,1,5,101,120,97,99,116,1,6,101,120,97,
+99,116,63,1,9,102,51,50,118,101,99,116,111,114,1,21,
+102,51,50,118,101,99,116,111,114,45,62,98,121,116,101,118,
+101,99,116,111,114,1,15,102,51,50,118,101,99,116,111,114,
+45,62,108,105,115,116,1,14,102,51,50,118,101,99,116,111,
+114,45,97,100,100,33,1,14,102,51,50,118,101,99,116,111,
+114,45,99,111,112,121,1,15,102,51,50,118,101,99,116,111,
+114,45,99,111,112,121,33,1,13,102,51,50,118,101,99,116,
+111,114,45,100,111,116,1,15,102,51,50,118,101,99,116,111,
+114,45,102,105,108,108,33,1,16,102,51,50,118,101,99,116,
+111,114,45,108,101,110,103,116,104,1,13,102,51,50,118,101,
+99,116,111,114,45,109,97,120,1,13,102,51,50,118,101,99,
+116,111,114,45,109,105,110,1,14,102,51,50,118,101,99,116,
+111,114,45,109,117,108,33,1,13,102,51,50,118,101,99,116,
+111,114,45,114,101,102,1,16,102,51,50,118,101,99,116,111,
+114,45,115,99,97,108,101,33,1,14,102,51,50,118,101,99,
+116,111,114,45,115,101,116,33,1,13,102,51,50,118,101,99,
+116,111,114,45,115,117,109,1,10,102,51,50,118,101,99,116,
+111,114,63,1,9,102,54,52,118,101,99,116,111,114,1,21,
+102,54,52,118,101,99,116,111,114,45,62,98,121,116,101,118,
+101,99,116,111,114,1,15,102,54,52,118,101,99,116,111,114,
+45,62,108,105,115,116,1,14,102,54,52,118,101,99,116,111,
+114,45,97,100,100,33,1,14,102,54,52,118,101,99,116,111,
+114,45,99,111,112,121,1,15,102,54,52,118,101,99,116,111,
+114,45,99,111,112,121,33,1,13,102,54,52,118,101,99,116,
+111,114,45,100,111,116,1,15,102,54,52,118,101,99,116,111,
+114,45,102,105,108,108,33,1,16,102,54,52,118,101,99,116,
+111,114,45,108,101,110,103,116,104,1,13,102,54,52,118,101,
+99,116,111,114,45,109,97,120,1,13,102,54,52,118,101,99,
+116,111,114,45,109,105,110,1,14,102,54,52,118,101,99,116,
+111,114,45,109,117,108,33,1,13,102,54,52,118,101,99,116,
+111,114,45,114,101,102,1,16,102,54,52,118,101,99,116,111,
+114,45,115,99,97,108,101,33,1,14,102,54,52,118,101,99,
+116,111,114,45,115,101,116,33,1,13,102,54,52,118,101,99,
+116,111,114,45,115,117,109,1,10,102,54,52,118,101,99,116,
+111,114,63,1,8,102,101,97,116,117,114,101,115,1,12,102,
+105,110,100,45,108,105,98,114,97,114,121,1,17,102,108,117,
+115,104,45,111,117,116,112,117,116,45,112,111,114,116,1,8,
+102,111,114,45,101,97,99,104,1,21,103,101,116,45,111,117,
+116,112,117,116,45,98,121,116,101,118,101,99,116,111,114,1,
+22,103,101,116,45,111,117,116,112,117,116,45,98,121,116,101,
+118,101,99,116,111,114,33,1,17,103,101,116,45,111,117,116,
+112,117,116,45,115,116,114,105,110,103,1,17,104,97,115,104,
+45,116,97,98,108,101,45,62,97,108,105,115,116,1,17,104,
+97,115,104,45,116,97,98,108,101,45,99,108,101,97,114,33,
+1,20,104,97,115,104,45,116,97,98,108,101,45,99,111,110,
+116,97,105,110,115,63,1,18,104,97,115,104,45,116,97,98,
+108,101,45,100,101,108,101,116,101,33,1,15,104,97,115,104,
+45,116,97,98,108,101,45,107,101,121,115,1,14,104,97,115,
+104,45,116,97,98,108,101,45,114,101,102,1,22,104,97,115,
+104,45,116,97,98,108,101,45,114,101,102,47,100,101,102,97,
+117,108,116,1,15,104,97,115,104,45,116,97,98,108,101,45,
+115,101,116,33,1,15,104,97,115,104,45,116,97,98,108,101,
+45,115,105,122,101,1,26,104,97,115,104,45,116,97,98,108,
+101,45,117,112,100,97,116,101,33,47,100,101,102,97,117,108,
+116,1,17,104,97,115,104,45,116,97,98,108,101,45,118,97,
+108,117,101,115,1,15,104,97,115,104,45,116,97,98,108,101,
+45,119,97,108,107,1,11,104,97,115,104,45,116,97,98,108,
+101,63,1,15,105,100,101,110,116,105,102,105,101,114,45,98,
+97,115,101,1,22,105,100,101,110,116,105,102,105,101,114,45,
+101,110,118,105,114,111,110,109,101,110,116,1,12,105,100,101,
+110,116,105,102,105,101,114,61,63,1,11,105,100,101,110,116,
+105,102,105,101,114,63,1,2,105,102,1,7,105,110,101,120,
+97,99,116,1,8,105,110,101,120,97,99,116,63,1,11,105,
+110,112,117,116,45,112,111,114,116,63,1,13,105,110,116,101,
+103,101,114,45,62,99,104,97,114,1,6,108,97,109,98,100,
+97,1,6,108,101,110,103,116,104,1,3,108,101,116,1,4,
+108,101,116,42,1,11,108,101,116,42,45,118,97,108,117,101,
+115,1,10,108,101,116,45,115,121,110,116,97,120,1,10,108,
+101,116,45,118,97,108,117,101,115,1,6,108,101,116,114,101,
+99,1,7,108,101,116,114,101,99,42,1,13,108,101,116,114,
+101,99,45,115,121,110,116,97,120,1,19,108,105,98,114,97,
+114,121,45,101,110,118,105,114,111,110,109,101,110,116,1,14,
+108,105,98,114,97,114,121,45,101,120,112,111,114,116,1,15,
+108,105,98,114,97,114,121,45,101,120,112,111,114,116,115,1,
+14,108,105,98,114,97,114,121,45,105,109,112,111,114,116,1,
+4,108,105,115,116,1,16,108,105,115,116,45,62,98,121,116,
+101,118,101,99,116,111,114,1,15,108,105,115,116,45,62,102,
+51,50,118,101,99,116,111,114,1,15,108,105,115,116,45,62,
+102,54,52,118,101,99,116,111,114,1,15,108,105,115,116,45,
+62,115,51,50,118,101,99,116,111,114,1,15,108,105,115,116,
+45,62,115,54,52,118,101,99,116,111,114,1,12,108,105,115,
+116,45,62,115,116,114,105,110,103,1,15,108,105,115,116,45,
+62,117,51,50,118,101,99,116,111,114,1,12,108,105,115,116,
+45,62,118,101,99,116,111,114,1,9,108,105,115,116,45,99,
+111,112,121,1,8,108,105,115,116,45,114,101,102,1,9,108,
+105,115,116,45,115,101,116,33,1,9,108,105,115,116,45,116,
+97,105,108,1,5,108,105,115,116,63,1,15,109,97,107,101,
+45,98,121,116,101,118,101,99,116,111,114,1,15,109,97,107,
+101,45,100,105,99,116,105,111,110,97,114,121,1,14,109,97,
+107,101,45,101,112,104,101,109,101,114,111,110,1,18,109,97,
+107,101,45,101,113,45,104,97,115,104,45,116,97,98,108,101,
+1,21,109,97,107,101,45,101,113,117,97,108,45,104,97,115,
+104,45,116,97,98,108,101,1,19,109,97,107,101,45,101,113,
+118,45,104,97,115,104,45,116,97,98,108,101,1,14,109,97,
+107,101,45,102,51,50,118,101,99,116,111,114,1,14,109,97,
+107,101,45,102,54,52,118,101,99,116,111,114,1,15,109,97,
+107,101,45,105,100,101,110,116,105,102,105,101,114,1,27,109,
+97,107,101,45,107,101,121,45,119,101,97,107,45,101,113,45,
+104,97,115,104,45,116,97,98,108,101,1,28,109,97,107,101,
+45,107,101,121,45,119,101,97,107,45,101,113,118,45,104,97,
+115,104,45,116,97,98,108,101,1,12,109,97,107,101,45,108,
+105,98,114,97,114,121,1,9,109,97,107,101,45,108,105,115,
+116,1,14,109,97,107,101,45,112,97,114,97,109,101,116,101,
+114,1,11,109,97,107,101,45,114,101,99,111,114,100,1,14,
+109,97,107,101,45,115,51,50,118,101,99,116,111,114,1,14,
+109,97,107,101,45,115,54,52,118,101,99,116,111,114,1,11,
+109,97,107,101,45,115,116,114,105,110,103,1,22,109,97,107,
+101,45,115,116,114,105,110,103,45,104,97,115,104,45,116,97,
+98,108,101,1,14,109,97,107,101,45,117,51,50,118,101,99,
+116,111,114,1,11,109,97,107,101,45,118,101,99,116,111,114,
+1,3,109,97,112,1,6,109,101,109,98,101,114,1,4,109,
+101,109,113,1,4,109,101,109,118,1,3,110,111,116,1,5,
+110,117,108,108,63,1,14,110,117,109,98,101,114,45,62,115,
+116,114,105,110,103,1,7,110,117,109,98,101,114,63,1,21,
+111,112,101,110,45,105,110,112,117,116,45,98,121,116,101,118,
+101,99,116,111,114,1,20,111,112,101,110,45,105,110,112,117,
+116,45,102,105,108,101,47,109,109,97,112,1,22,111,112,101,
+110,45,111,117,116,112,117,116,45,98,121,116,101,118,101,99,
+116,111,114,1,18,111,112,101,110,45,111,117,116,112,117,116,
+45,115,116,114,105,110,103,1,2,111,114,1,12,111,117,116,
+112,117,116,45,112,111,114,116,63,1,5,112,97,105,114,63,
+1,12,112,97,114,97,109,101,116,101,114,105,122,101,1,7,
+112,101,101,107,45,117,56,1,17,112,108,105,115,116,45,62,
+100,105,99,116,105,111,110,97,114,121,1,10,112,111,114,116,
+45,111,112,101,110,63,1,5,112,111,114,116,63,1,10,112,
+114,111,99,101,100,117,114,101,63,1,10,113,117,97,115,105,
+113,117,111,116,101,1,5,113,117,111,116,101,1,5,114,97,
+105,115,101,1,17,114,97,105,115,101,45,99,111,110,116,105,
+110,117,97,98,108,101,1,4,114,101,97,100,1,15,114,101,
+97,100,45,98,121,116,101,118,101,99,116,111,114,1,16,114,
+101,97,100,45,98,121,116,101,118,101,99,116,111,114,33,1,
+7,114,101,97,100,45,117,56,1,12,114,101,99,111,114,100,
+45,100,97,116,117,109,1,11,114,101,99,111,114,100,45,116,
+121,112,101,1,7,114,101,99,111,114,100,63,1,7,114,101,
+118,101,114,115,101,1,9,115,51,50,118,101,99,116,111,114,
+1,21,115,51,50,118,101,99,116,111,114,45,62,98,121,116,
+101,118,101,99,116,111,114,1,15,115,51,50,118,101,99,116,
+111,114,45,62,108,105,115,116,1,14,115,51,50,118,101,99,
+116,111,114,45,97,100,100,33,1,14,115,51,50,118,101,99,
+116,111,114,45,99,111,112,121,1,15,115,51,50,118,101,99,
+116,111,114,45,99,111,112,121,33,1,13,115,51,50,118,101,
+99,116,111,114,45,100,111,116,1,15,115,51,50,118,101,99,
+116,111,114,45,102,105,108,108,33,1,16,115,51,50,118,101,
+99,116,111,114,45,108,101,110,103,116,104,1,13,115,51,50,
+118,101,99,116,111,114,45,109,97,120,1,13,115,51,50,118,
+101,99,116,111,114,45,109,105,110,1,14,115,51,50,118,101,
+99,116,111,114,45,109,117,108,33,1,13,115,51,50,118,101,
+99,116,111,114,45,114,101,102,1,16,115,51,50,118,101,99,
+116,111,114,45,115,99,97,108,101,33,1,14,115,51,50,118,
+101,99,116,111,114,45,115,101,116,33,1,13,115,51,50,118,
+101,99,116,111,114,45,115,117,109,1,10,115,51,50,118,101,
+99,116,111,114,63,1,9,115,54,52,118,101,99,116,111,114,
+1,21,115,54,52,118,101,99,116,111,114,45,62,98,121,116,
+101,118,101,99,116,111,114,1,15,115,54,52,118,101,99,116,
+111,114,45,62,108,105,115,116,1,14,115,54,52,118,101,99,
+116,111,114,45,97,100,100,33,1,14,115,54,52,118,101,99,
+116,111,114,45,99,111,112,121,1,15,115,54,52,118,101,99,
+116,111,114,45,99,111,112,121,33,1,13,115,54,52,118,101,
+99,116,111,114,45,100,111,116,1,15,115,54,52,118,101,99,
+116,111,114,45,102,105,108,108,33,1,16,115,54,52,118,101,
+99,116,111,114,45,108,101,110,103,116,104,1,13,115,54,52,
+118,101,99,116,111,114,45,109,97,120,1,13,115,54,52,118,
+101,99,116,111,114,45,109,105,110,1,14,115,54,52,118,101,
+99,116,111,114,45,109,117,108,33,1,13,115,54,52,118,101,
+99,116,111,114,45,114,101,102,1,16,115,54,52,118,101,99,
+116,111,114,45,115,99,97,108,101,33,1,14,115,54,52,118,
+101,99,116,111,114,45,115,101,116,33,1,13,115,54,52,118,
+101,99,116,111,114,45,115,117,109,1,10,115,54,52,118,101,
+99,116,111,114,63,1,4,115,101,116,33,1,8,115,101,116,
+45,99,97,114,33,1,8,115,101,116,45,99,100,114,33,1,
+6,115,116,114,105,110,103,1,12,115,116,114,105,110,103,45,
+62,108,105,115,116,1,14,115,116,114,105,110,103,45,62,110,
+117,109,98,101,114,1,14,115,116,114,105,110,103,45,62,115,
+121,109,98,111,108,1,14,115,116,114,105,110,103,45,62,118,
+101,99,116,111,114,1,13,115,116,114,105,110,103,45,97,112,
+112,101,110,100,1,15,115,116,114,105,110,103,45,99,111,110,
+116,97,105,110,115,1,11,115,116,114,105,110,103,45,99,111,
+112,121,1,12,115,116,114,105,110,103,45,99,111,112,121,33,
+1,12,115,116,114,105,110,103,45,102,105,108,108,33,1,15,
+115,116,114,105,110,103,45,102,111,114,45,101,97,99,104,1,
+12,115,116,114,105,110,103,45,105,110,100,101,120,1,11,115,
+116,114,105,110,103,45,106,111,105,110,1,13,115,116,114,105,
+110,103,45,108,101,110,103,116,104,1,10,115,116,114,105,110,
+103,45,109,97,112,1,10,115,116,114,105,110,103,45,114,101,
+102,1,21,115,116,114,105,110,103,45,115,101,97,114,99,104,
+45,102,111,114,119,97,114,100,1,11,115,116,114,105,110,103,
+45,115,101,116,33,1,12,115,116,114,105,110,103,45,115,112,
+108,105,116,1,9,115,116,114,105,110,103,60,61,63,1,8,
+115,116,114,105,110,103,60,63,1,8,115,116,114,105,110,103,
+61,63,1,9,115,116,114,105,110,103,62,61,63,1,8,115,
+116,114,105,110,103,62,63,1,7,115,116,114,105,110,103,63,
+1,14,115,121,109,98,111,108,45,62,115,116,114,105,110,103,
+1,8,115,121,109,98,111,108,61,63,1,7,115,121,109,98,
+111,108,63,1,12,115,121,110,116,97,120,45,101,114,114,111,
+114,1,17,115,121,110,116,97,120,45,113,117,97,115,105,113,
+117,111,116,101,1,12,115,121,110,116,97,120,45,113,117,111,
+116,101,1,14,115,121,110,116,97,120,45,117,110,113,117,111,
+116,101,1,23,115,121,110,116,97,120,45,117,110,113,117,111,
+116,101,45,115,112,108,105,99,105,110,103,1,9,117,51,50,
+118,101,99,116,111,114,1,21,117,51,50,118,101,99,116,111,
+114,45,62,98,121,116,101,118,101,99,116,111,114,1,15,117,
+51,50,118,101,99,116,111,114,45,62,108,105,115,116,1,14,
+117,51,50,118,101,99,116,111,114,45,97,100,100,33,1,14,
+117,51,50,118,101,99,116,111,114,45,99,111,112,121,1,15,
+117,51,50,118,101,99,116,111,114,45,99,111,112,121,33,1,
+13,117,51,50,118,101,99,116,111,114,45,100,111,116,1,15,
+117,51,50,118,101,99,116,111,114,45,102,105,108,108,33,1,
+16,117,51,50,118,101,99,116,111,114,45,108,101,110,103,116,
+104,1,13,117,51,50,118,101,99,116,111,114,45,109,97,120,
+1,13,117,51,50,118,101,99,116,111,114,45,109,105,110,1,
+14,117,51,50,118,101,99,116,111,114,45,109,117,108,33,1,
+13,117,51,50,118,101,99,116,111,114,45,114,101,102,1,16,
+117,51,50,118,101,99,116,111,114,45,115,99,97,108,101,33,
+1,14,117,51,50,118,101,99,116,111,114,45,115,101,116,33,
+1,13,117,51,50,118,101,99,116,111,114,45,115,117,109,1,
+10,117,51,50,118,101,99,116,111,114,63,1,9,117,56,45,
+114,101,97,100,121,63,1,6,117,110,108,101,115,115,1,7,
+117,110,113,117,111,116,101,1,16,117,110,113,117,111,116,101,
+45,115,112,108,105,99,105,110,103,1,6,118,97,108,117,101,
+115,1,6,118,101,99,116,111,114,1,12,118,101,99,116,111,
+114,45,62,108,105,115,116,1,14,118,101,99,116,111,114,45,
+62,115,116,114,105,110,103,1,13,118,101,99,116,111,114,45,
+97,112,112,101,110,100,1,11,118,101,99,116,111,114,45,99,
+111,112,121,1,12,118,101,99,116,111,114,45,99,111,112,121,
+33,1,12,118,101,99,116,111,114,45,102,105,108,108,33,1,
+15,118,101,99,116,111,114,45,102,111,114,45,101,97,99,104,
+1,13,118,101,99,116,111,114,45,108,101,110,103,116,104,1,
+10,118,101,99,116,111,114,45,109,97,112,1,10,118,101,99,
+116,111,114,45,114,101,102,1,11,118,101,99,116,111,114,45,
+115,101,116,33,1,7,118,101,99,116,111,114,63,1,4,119,
+104,101,110,1,22,119,105,116,104,45,101,120,99,101,112,116,
+105,111,110,45,104,97,110,100,108,101,114,1,5,119,114,105,
+116,101,1,16,119,114,105,116,101,45,98,121,116,101,118,101,
+99,116,111,114,1,12,119,114,105,116,101,45,115,104,97,114,
+101,100,1,12,119,114,105,116,101,45,115,105,109,112,108,101,
+1,12,119,114,105,116,101,45,115,116,114,105,110,103,1,8,
+119,114,105,116,101,45,117,56,3,11,112,105,99,114,105,110,
+46,117,115,101,114,6,11,1,24,112,105,99,114,105,110,46,
+98,97,115,101,47,99,104,101,99,107,45,102,111,114,109,97,
+108,14,5,6,6,15,0,1,15,112,105,99,114,105,110,46,
+98,97,115,101,47,101,113,63,1,16,112,105,99,114,105,110,
+46,98,97,115,101,47,109,101,109,113,1,20,112,105,99,114,
+105,110,46,98,97,115,101,47,102,101,97,116,117,114,101,115,
+1,16,112,105,99,114,105,110,46,98,97,115,101,47,101,113,
+118,63,1,7,108,105,98,114,97,114,121,1,16,112,105,99,
+114,105,110,46,98,97,115,101,47,99,97,100,114,1,24,112,
+105,99,114,105,110,46,98,97,115,101,47,102,105,110,100,45,
+108,105,98,114,97,114,121,1,18,112,105,99,114,105,110,46,
+98,97,115,101,47,109,97,110,103,108,101,1,16,112,105,99,
+114,105,110,46,98,97,115,101,47,99,97,97,114,1,21,112,
+105,99,114,105,110,46,98,97,115,101,47,116,104,101,45,98,
+101,103,105,110,1,18,112,105,99,114,105,110,46,98,97,115,
+101,47,97,112,112,101,110,100,1,16,112,105,99,114,105,110,
+46,98,97,115,101,47,99,100,97,114,1,14,100,101,102,105,
+110,101,45,108,105,98,114,97,114,121,14,6,6,6,1,13,
+112,105,99,114,105,110,46,98,97,115,101,47,43,6,6,6,
+6,15,0,1,23,112,105,99,114,105,110,46,98,97,115,101,
+47,105,100,101,110,116,105,102,105,101,114,63,1,16,112,105,
+99,114,105,110,46,98,97,115,101,47,104,101,114,101,6,6,
+15,0,1,16,112,105,99,114,105,110,46,98,97,115,101,47,
+99,100,100,114,1,24,112,105,99,114,105,110,46,98,97,115,
+101,47,109,97,107,101,45,108,105,98,114,97,114,121,1,20,
+112,105,99,114,105,110,46,98,97,115,101,47,102,111,114,45,
+101,97,99,104,1,16,112,105,99,114,105,110,46,98,97,115,
+101,47,101,118,97,108,1,6,101,120,112,111,114,116,14,8,
+6,6,1,13,112,105,99,114,105,110,46,98,97,115,101,47,
+45,6,6,6,6,14,11,6,6,15,0,1,17,112,105,99,
+114,105,110,46,98,97,115,101,47,108,105,115,116,63,1,18,
+112,105,99,114,105,110,46,98,97,115,101,47,108,101,110,103,
+116,104,1,6,114,101,110,97,109,101,1,17,112,105,99,114,
+105,110,46,98,97,115,101,47,101,114,114,111,114,3,16,109,
+97,108,102,111,114,109,101,100,32,101,120,112,111,114,116,1,
+20,112,105,99,114,105,110,46,98,97,115,101,47,108,105,115,
+116,45,114,101,102,1,26,112,105,99,114,105,110,46,98,97,
+115,101,47,108,105,98,114,97,114,121,45,101,120,112,111,114,
+116,1,6,105,109,112,111,114,116,14,16,6,6,1,13,112,
+105,99,114,105,110,46,98,97,115,101,47,61,6,6,6,6,
+15,0,3,53,108,105,98,114,97,114,121,32,110,97,109,101,
+32,115,104,111,117,108,100,32,98,101,32,97,32,108,105,115,
+116,32,111,102,32,97,116,32,108,101,97,115,116,32,111,110,
+101,32,115,121,109,98,111,108,115,1,15,112,105,99,114,105,
+110,46,98,97,115,101,47,109,97,112,3,1,46,1,19,112,
+105,99,114,105,110,46,98,97,115,101,47,110,117,109,98,101,
+114,63,1,18,112,105,99,114,105,110,46,98,97,115,101,47,
+101,120,97,99,116,63,3,29,115,121,109,98,111,108,32,111,
+114,32,105,110,116,101,103,101,114,32,105,115,32,114,101,113,
+117,105,114,101,100,1,26,112,105,99,114,105,110,46,98,97,
+115,101,47,110,117,109,98,101,114,45,62,115,116,114,105,110,
+103,1,26,112,105,99,114,105,110,46,98,97,115,101,47,115,
+121,109,98,111,108,45,62,115,116,114,105,110,103,1,27,112,
+105,99,114,105,110,46,98,97,115,101,47,115,116,114,105,110,
+103,45,102,111,114,45,101,97,99,104,1,18,112,105,99,114,
+105,110,46,98,97,115,101,47,99,104,97,114,61,63,3,51,
+101,108,101,109,101,110,116,115,32,111,102,32,108,105,98,114,
+97,114,121,32,110,97,109,101,32,109,97,121,32,110,111,116,
+32,99,111,110,116,97,105,110,32,39,46,39,32,111,114,32,
+39,47,39,1,25,112,105,99,114,105,110,46,98,97,115,101,
+47,115,116,114,105,110,103,45,97,112,112,101,110,100,1,15,
+112,105,99,114,105,110,46,98,97,115,101,47,116,104,101,14,
+30,6,6,15,0,1,26,112,105,99,114,105,110,46,98,97,
+115,101,47,115,116,114,105,110,103,45,62,115,121,109,98,111,
+108,3,17,108,105,98,114,97,114,121,32,110,111,116,32,102,
+111,117,110,100,1,4,111,110,108,121,1,6,112,114,101,102,
+105,120,1,6,101,120,99,101,112,116,1,27,112,105,99,114,
+105,110,46,98,97,115,101,47,108,105,98,114,97,114,121,45,
+101,120,112,111,114,116,115,1,1,120,1,16,112,105,99,114,
+105,110,46,98,97,115,101,47,97,115,115,113,1,26,112,105,
+99,114,105,110,46,98,97,115,101,47,108,105,98,114,97,114,
+121,45,105,109,112,111,114,116,1,14,112,105,99,114,105,110,
+46,98,97,115,101,47,61,62,14,31,6,6,6,6,6,15,
+0,1,27,112,105,99,114,105,110,46,98,97,115,101,47,109,
+97,107,101,45,105,100,101,110,116,105,102,105,101,114,8,6,
+6,15,0,3,37,105,110,118,97,108,105,100,32,117,115,101,
+32,111,102,32,97,117,120,105,108,105,97,114,121,32,115,121,
+110,116,97,120,58,32,39,61,62,39,1,15,112,105,99,114,
+105,110,46,98,97,115,101,47,97,110,100,14,32,6,6,6,
+6,1,29,112,105,99,114,105,110,46,98,97,115,101,47,116,
+104,101,45,98,117,105,108,116,105,110,45,98,101,103,105,110,
+8,6,6,15,0,1,16,112,105,99,114,105,110,46,98,97,
+115,101,47,108,105,115,116,1,18,112,105,99,114,105,110,46,
+98,97,115,101,47,116,104,101,45,105,102,1,17,112,105,99,
+114,105,110,46,98,97,115,101,47,98,101,103,105,110,14,33,
+6,6,6,6,1,13,98,117,105,108,116,105,110,58,98,101,
+103,105,110,1,30,112,105,99,114,105,110,46,98,97,115,101,
+47,116,104,101,45,98,117,105,108,116,105,110,45,100,101,102,
+105,110,101,8,6,6,15,0,1,41,112,105,99,114,105,110,
+46,98,97,115,101,47,99,97,108,108,45,119,105,116,104,45,
+99,117,114,114,101,110,116,45,101,110,118,105,114,111,110,109,
+101,110,116,14,34,6,6,1,17,112,105,99,114,105,110,46,
+98,97,115,101,47,97,112,112,108,121,6,6,1,14,98,117,
+105,108,116,105,110,58,100,101,102,105,110,101,1,36,112,105,
+99,114,105,110,46,98,97,115,101,47,116,104,101,45,98,117,
+105,108,116,105,110,45,100,101,102,105,110,101,45,109,97,99,
+114,111,8,6,6,15,0,1,16,112,105,99,114,105,110,46,
+98,97,115,101,47,99,97,115,101,14,35,6,6,6,6,1,
+20,98,117,105,108,116,105,110,58,100,101,102,105,110,101,45,
+109,97,99,114,111,1,26,112,105,99,114,105,110,46,98,97,
+115,101,47,116,104,101,45,98,117,105,108,116,105,110,45,105,
+102,8,6,6,15,0,1,3,107,101,121,1,24,112,105,99,
+114,105,110,46,98,97,115,101,47,105,100,101,110,116,105,102,
+105,101,114,61,63,1,21,112,105,99,114,105,110,46,98,97,
+115,101,47,116,104,101,45,113,117,111,116,101,1,16,112,105,
+99,114,105,110,46,98,97,115,101,47,99,111,110,100,14,38,
+6,6,6,6,1,10,98,117,105,108,116,105,110,58,105,102,
+1,30,112,105,99,114,105,110,46,98,97,115,101,47,116,104,
+101,45,98,117,105,108,116,105,110,45,108,97,109,98,100,97,
+8,6,6,15,0,1,3,116,109,112,1,18,112,105,99,114,
+105,110,46,98,97,115,101,47,100,101,102,105,110,101,14,39,
+6,6,6,6,1,14,98,117,105,108,116,105,110,58,108,97,
+109,98,100,97,1,29,112,105,99,114,105,110,46,98,97,115,
+101,47,116,104,101,45,98,117,105,108,116,105,110,45,113,117,
+111,116,101,8,6,6,15,0,3,38,100,101,102,105,110,101,
+58,32,98,105,110,100,105,110,103,32,116,111,32,110,111,110,
+45,118,97,114,97,105,98,108,101,32,111,98,106,101,99,116,
+1,22,112,105,99,114,105,110,46,98,97,115,101,47,116,104,
+101,45,100,101,102,105,110,101,1,22,112,105,99,114,105,110,
+46,98,97,115,101,47,116,104,101,45,108,97,109,98,100,97,
+3,19,105,108,108,101,103,97,108,32,100,101,102,105,110,101,
+32,102,111,114,109,3,19,105,108,108,101,103,97,108,32,100,
+101,102,105,110,101,32,102,111,114,109,1,35,112,105,99,114,
+105,110,46,98,97,115,101,47,100,101,102,105,110,101,45,97,
+117,120,105,108,105,97,114,121,45,115,121,110,116,97,120,14,
+40,6,6,6,6,1,13,98,117,105,108,116,105,110,58,113,
+117,111,116,101,1,28,112,105,99,114,105,110,46,98,97,115,
+101,47,116,104,101,45,98,117,105,108,116,105,110,45,115,101,
+116,33,8,6,6,15,0,3,34,105,110,118,97,108,105,100,
+32,117,115,101,32,111,102,32,97,117,120,105,108,105,97,114,
+121,32,115,121,110,116,97,120,58,32,39,3,1,39,1,28,
+112,105,99,114,105,110,46,98,97,115,101,47,116,104,101,45,
+100,101,102,105,110,101,45,109,97,99,114,111,1,1,95,1,
+24,112,105,99,114,105,110,46,98,97,115,101,47,100,101,102,
+105,110,101,45,109,97,99,114,111,14,41,6,6,6,6,1,
+12,98,117,105,108,116,105,110,58,115,101,116,33,8,6,6,
+15,0,3,25,105,108,108,101,103,97,108,32,100,101,102,105,
+110,101,45,109,97,99,114,111,32,102,111,114,109,3,44,100,
+101,102,105,110,101,45,109,97,99,114,111,58,32,98,105,110,
+100,105,110,103,32,116,111,32,110,111,110,45,118,97,114,105,
+97,98,108,101,32,111,98,106,101,99,116,1,25,112,105,99,
+114,105,110,46,98,97,115,101,47,100,101,102,105,110,101,45,
+115,121,110,116,97,120,14,42,6,6,6,6,8,6,6,15,
+0,1,11,116,114,97,110,115,102,111,114,109,101,114,1,25,
+112,105,99,114,105,110,46,98,97,115,101,47,100,101,102,105,
+110,101,45,118,97,108,117,101,115,14,43,6,6,6,6,8,
+6,6,15,0,1,9,97,114,103,117,109,101,110,116,115,1,
+20,112,105,99,114,105,110,46,98,97,115,101,47,116,104,101,
+45,115,101,116,33,1,14,112,105,99,114,105,110,46,98,97,
+115,101,47,100,111,14,46,6,6,6,6,8,6,6,15,0,
+1,4,108,111,111,112,1,16,112,105,99,114,105,110,46,98,
+97,115,101,47,101,108,115,101,14,49,6,6,6,6,8,6,
+6,15,0,3,39,105,110,118,97,108,105,100,32,117,115,101,
+32,111,102,32,97,117,120,105,108,105,97,114,121,32,115,121,
+110,116,97,120,58,32,39,101,108,115,101,39,1,14,112,105,
+99,114,105,110,46,98,97,115,101,47,105,102,14,50,6,6,
+6,6,8,6,15,0,3,15,105,108,108,101,103,97,108,32,
+105,102,32,102,111,114,109,1,18,112,105,99,114,105,110,46,
+98,97,115,101,47,108,97,109,98,100,97,14,51,6,6,6,
+6,1,23,112,105,99,114,105,110,46,98,97,115,101,47,116,
+114,97,110,115,102,111,114,109,101,114,14,52,15,0,3,19,
+105,108,108,101,103,97,108,32,108,97,109,98,100,97,32,102,
+111,114,109,3,19,105,108,108,101,103,97,108,32,108,97,109,
+98,100,97,32,102,111,114,109,1,15,112,105,99,114,105,110,
+46,98,97,115,101,47,108,101,116,14,57,6,6,1,29,99,
+97,108,108,45,119,105,116,104,45,99,117,114,114,101,110,116,
+45,101,110,118,105,114,111,110,109,101,110,116,6,6,15,0,
+1,26,112,105,99,114,105,110,46,98,97,115,101,47,109,97,
+107,101,45,101,112,104,101,109,101,114,111,110,1,19,112,105,
+99,114,105,110,46,98,97,115,101,47,118,101,99,116,111,114,
+63,1,24,112,105,99,114,105,110,46,98,97,115,101,47,108,
+105,115,116,45,62,118,101,99,116,111,114,1,24,112,105,99,
+114,105,110,46,98,97,115,101,47,118,101,99,116,111,114,45,
+62,108,105,115,116,15,0,1,15,112,105,99,114,105,110,46,
+98,97,115,101,47,99,97,114,1,16,112,105,99,114,105,110,
+46,98,97,115,101,47,108,101,116,42,14,58,6,6,6,6,
+15,0,1,23,112,105,99,114,105,110,46,98,97,115,101,47,
+108,101,116,42,45,118,97,108,117,101,115,14,59,6,6,6,
+6,15,0,1,22,112,105,99,114,105,110,46,98,97,115,101,
+47,108,101,116,45,115,121,110,116,97,120,14,60,6,6,6,
+6,15,0,1,22,112,105,99,114,105,110,46,98,97,115,101,
+47,108,101,116,45,118,97,108,117,101,115,14,61,6,6,6,
+6,15,0,1,18,112,105,99,114,105,110,46,98,97,115,101,
+47,108,101,116,114,101,99,14,62,6,6,1,15,112,105,99,
+114,105,110,46,98,97,115,101,47,99,100,114,6,6,15,0,
+1,19,112,105,99,114,105,110,46,98,97,115,101,47,108,101,
+116,114,101,99,42,14,63,6,6,6,6,15,0,1,25,112,
+105,99,114,105,110,46,98,97,115,101,47,108,101,116,114,101,
+99,45,115,121,110,116,97,120,14,66,6,6,1,12,99,104,
+101,99,107,45,102,111,114,109,97,108,6,6,15,0,1,14,
+112,105,99,114,105,110,46,98,97,115,101,47,111,114,14,68,
+6,6,6,6,15,0,1,2,105,116,1,24,112,105,99,114,
+105,110,46,98,97,115,101,47,112,97,114,97,109,101,116,101,
+114,105,122,101,14,69,6,6,6,6,15,0,1,22,112,105,
+99,114,105,110,46,98,97,115,101,47,113,117,97,115,105,113,
+117,111,116,101,14,70,6,6,1,16,112,105,99,114,105,110,
+46,98,97,115,101,47,99,111,110,115,6,6,15,0,1,17,
+112,105,99,114,105,110,46,98,97,115,101,47,113,117,111,116,
+101,14,75,6,6,1,30,112,105,99,114,105,110,46,98,97,
+115,101,47,99,117,114,114,101,110,116,45,101,114,114,111,114,
+45,112,111,114,116,6,6,15,0,3,18,105,108,108,101,103,
+97,108,32,113,117,111,116,101,32,102,111,114,109,1,16,112,
+105,99,114,105,110,46,98,97,115,101,47,115,101,116,33,14,
+76,6,6,1,38,112,105,99,114,105,110,46,98,97,115,101,
+47,99,117,114,114,101,110,116,45,101,120,99,101,112,116,105,
+111,110,45,104,97,110,100,108,101,114,115,6,6,15,0,3,
+17,105,108,108,101,103,97,108,32,115,101,116,33,32,102,111,
+114,109,3,17,105,108,108,101,103,97,108,32,115,101,116,33,
+32,102,111,114,109,1,24,112,105,99,114,105,110,46,98,97,
+115,101,47,115,121,110,116,97,120,45,101,114,114,111,114,14,
+77,6,6,1,30,112,105,99,114,105,110,46,98,97,115,101,
+47,99,117,114,114,101,110,116,45,105,110,112,117,116,45,112,
+111,114,116,6,6,15,0,1,29,112,105,99,114,105,110,46,
+98,97,115,101,47,115,121,110,116,97,120,45,113,117,97,115,
+105,113,117,111,116,101,14,78,6,6,1,31,112,105,99,114,
+105,110,46,98,97,115,101,47,99,117,114,114,101,110,116,45,
+111,117,116,112,117,116,45,112,111,114,116,6,6,15,0,1,
+24,112,105,99,114,105,110,46,98,97,115,101,47,115,121,110,
+116,97,120,45,113,117,111,116,101,14,84,6,6,6,6,15,
+0,1,4,119,97,108,107,1,1,102,1,4,102,111,114,109,
+1,26,112,105,99,114,105,110,46,98,97,115,101,47,115,121,
+110,116,97,120,45,117,110,113,117,111,116,101,14,87,6,6,
+1,23,100,101,102,105,110,101,45,97,117,120,105,108,105,97,
+114,121,45,115,121,110,116,97,120,6,6,15,0,3,49,105,
+110,118,97,108,105,100,32,117,115,101,32,111,102,32,97,117,
+120,105,108,105,97,114,121,32,115,121,110,116,97,120,58,32,
+39,115,121,110,116,97,120,45,117,110,113,117,111,116,101,39,
+1,35,112,105,99,114,105,110,46,98,97,115,101,47,115,121,
+110,116,97,120,45,117,110,113,117,111,116,101,45,115,112,108,
+105,99,105,110,103,14,88,6,6,6,6,15,0,3,58,105,
+110,118,97,108,105,100,32,117,115,101,32,111,102,32,97,117,
+120,105,108,105,97,114,121,32,115,121,110,116,97,120,58,32,
+39,115,121,110,116,97,120,45,117,110,113,117,111,116,101,45,
+115,112,108,105,99,105,110,103,39,1,18,112,105,99,114,105,
+110,46,98,97,115,101,47,117,110,108,101,115,115,14,89,6,
+6,6,6,15,0,1,19,112,105,99,114,105,110,46,98,97,
+115,101,47,117,110,113,117,111,116,101,14,90,6,6,6,6,
+15,0,3,42,105,110,118,97,108,105,100,32,117,115,101,32,
+111,102,32,97,117,120,105,108,105,97,114,121,32,115,121,110,
+116,97,120,58,32,39,117,110,113,117,111,116,101,39,1,28,
+112,105,99,114,105,110,46,98,97,115,101,47,117,110,113,117,
+111,116,101,45,115,112,108,105,99,105,110,103,14,91,6,6,
+6,15,0,3,51,105,110,118,97,108,105,100,32,117,115,101,
+32,111,102,32,97,117,120,105,108,105,97,114,121,32,115,121,
+110,116,97,120,58,32,39,117,110,113,117,111,116,101,45,115,
+112,108,105,99,105,110,103,39,1,16,112,105,99,114,105,110,
+46,98,97,115,101,47,119,104,101,110,14,92,6,6,15,0,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,1,4,104,101,114,101,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,1,6,109,97,
+110,103,108,101,6,6,6,6,6,6,1,15,112,105,99,114,
+105,110,46,98,97,115,101,47,110,111,116,6,6,1,17,112,
+105,99,114,105,110,46,98,97,115,101,47,110,117,108,108,63,
+6,6,6,6,6,6,6,6,1,17,112,105,99,114,105,110,
+46,98,97,115,101,47,112,97,105,114,63,6,6,6,6,6,
+6,6,6,6,6,1,26,112,105,99,114,105,110,46,98,97,
+115,101,47,115,116,114,105,110,103,45,62,110,117,109,98,101,
+114,6,6,6,6,6,6,6,6,6,6,1,19,112,105,99,
+114,105,110,46,98,97,115,101,47,115,121,109,98,111,108,63,
+6,6,6,6,6,6,6,6,6,6,6,6,1,3,116,104,
+101,6,6,1,9,116,104,101,45,98,101,103,105,110,6,6,
+1,17,116,104,101,45,98,117,105,108,116,105,110,45,98,101,
+103,105,110,6,6,1,18,116,104,101,45,98,117,105,108,116,
+105,110,45,100,101,102,105,110,101,6,6,1,24,116,104,101,
+45,98,117,105,108,116,105,110,45,100,101,102,105,110,101,45,
+109,97,99,114,111,6,6,1,14,116,104,101,45,98,117,105,
+108,116,105,110,45,105,102,6,6,1,18,116,104,101,45,98,
+117,105,108,116,105,110,45,108,97,109,98,100,97,6,6,1,
+17,116,104,101,45,98,117,105,108,116,105,110,45,113,117,111,
+116,101,6,6,1,16,116,104,101,45,98,117,105,108,116,105,
+110,45,115,101,116,33,6,6,1,10,116,104,101,45,100,101,
+102,105,110,101,6,6,1,16,116,104,101,45,100,101,102,105,
+110,101,45,109,97,99,114,111,6,6,1,6,116,104,101,45,
+105,102,6,6,1,10,116,104,101,45,108,97,109,98,100,97,
+6,6,1,9,116,104,101,45,113,117,111,116,101,6,6,1,
+8,116,104,101,45,115,101,116,33,6,6,6,6,6,6,6,
+6,6,6,6,6,6,1,2,3,4,218,3,193,1,219,3,
+220,3,221,3,222,3,221,3,196,2,221,3,128,1,221,3,
+204,2,223,3,224,3,225,3,223,3,226,3,227,3,228,3,
+229,3,240,3,240,3,213,3,7,225,3,223,3,245,3,224,
+3,246,3,247,3,248,3,9,10,247,3,134,4,135,4,218,
+3,136,4,137,4,138,4,139,4,139,4,140,4,12,13,137,
+4,151,4,152,4,153,4,14,154,4,155,4,137,4,156,4,
+157,4,158,4,159,4,15,160,4,160,4,137,4,161,4,162,
+4,17,18,19,20,21,22,247,3,168,4,162,4,158,4,158,
+4,225,3,224,3,137,4,169,4,221,3,170,4,221,3,136,
+4,221,3,171,4,221,3,172,4,223,3,23,24,25,26,27,
+28,221,3,170,4,221,3,136,4,221,3,171,4,221,3,172,
+4,152,4,173,4,223,3,223,3,152,4,223,3,152,4,245,
+3,152,4,223,3,152,4,245,3,29,247,3,219,3,226,3,
+245,3,156,1,174,4,152,1,174,4,175,4,175,4,176,4,
+185,4,241,3,137,4,190,4,245,3,202,4,203,4,223,3,
+163,4,128,1,245,3,223,3,135,4,202,4,197,4,223,3,
+227,3,245,3,197,4,223,3,202,4,223,3,36,185,4,241,
+4,241,3,163,4,145,2,37,203,4,240,3,242,4,163,4,
+193,1,185,4,163,4,204,2,228,3,152,4,240,3,223,3,
+242,4,163,4,124,185,4,223,3,227,3,228,3,163,4,198,
+1,243,4,240,3,242,4,163,4,193,1,185,4,240,3,223,
+3,242,4,163,4,124,185,4,223,3,202,4,203,4,227,3,
+163,4,169,1,185,4,128,5,241,3,202,4,163,4,145,2,
+202,4,202,4,202,4,203,4,202,4,245,3,163,4,169,1,
+185,4,128,5,241,3,202,4,163,4,145,2,202,4,202,4,
+202,4,203,4,163,4,169,1,227,3,135,4,240,3,223,3,
+223,3,137,4,141,5,202,4,142,5,223,3,143,5,223,3,
+245,3,137,4,144,5,211,4,137,4,145,5,162,4,158,5,
+158,4,223,3,159,5,202,4,160,5,223,3,202,4,143,5,
+161,5,202,4,163,4,199,1,135,4,137,4,173,5,240,3,
+223,3,137,4,174,5,224,4,160,5,163,4,185,5,227,3,
+228,3,163,4,178,1,143,5,228,3,44,45,185,4,196,5,
+241,3,227,3,228,3,163,4,154,1,143,5,228,3,143,5,
+228,3,240,3,142,5,142,5,228,3,240,3,197,5,197,5,
+163,4,156,1,228,3,163,4,160,1,47,48,185,4,208,5,
+241,3,163,4,145,2,152,4,203,4,227,3,228,3,227,3,
+228,3,228,3,152,4,223,3,137,4,219,5,135,4,137,4,
+229,5,202,4,236,4,139,4,139,4,236,4,135,4,213,3,
+223,3,137,4,239,5,202,4,251,4,223,3,227,3,245,3,
+137,4,240,5,53,54,55,56,249,5,249,5,220,4,185,4,
+240,3,250,5,251,5,252,5,240,3,223,3,143,5,152,4,
+254,5,223,3,245,3,152,4,223,3,223,3,202,4,202,4,
+143,5,202,4,142,5,223,3,143,5,152,4,254,5,245,3,
+245,3,223,3,152,4,223,3,245,3,163,4,145,2,228,3,
+163,4,146,2,228,3,228,3,163,4,145,2,228,3,163,4,
+154,1,143,5,228,3,163,4,143,2,228,3,163,4,147,2,
+228,3,228,3,163,4,145,2,228,3,163,4,152,2,228,3,
+163,4,147,2,228,3,163,4,151,2,228,3,64,65,152,4,
+152,4,254,5,152,4,163,4,145,2,228,3,228,3,228,3,
+163,4,131,3,228,3,67,145,2,228,3,152,4,228,3,163,
+4,178,1,223,3,185,4,185,6,202,4,163,4,145,2,202,
+4,202,4,223,3,202,4,203,4,163,4,204,2,245,3,163,
+4,191,1,223,3,143,5,163,4,207,2,228,3,227,3,228,
+3,71,72,73,74,223,3,240,3,242,4,163,4,213,2,185,
+4,240,3,242,4,163,4,186,3,185,4,240,3,226,3,242,
+4,163,4,187,3,185,4,226,3,250,5,202,4,163,4,214,
+2,202,4,163,4,165,2,252,5,202,4,163,4,170,1,202,
+4,163,4,157,2,202,4,163,4,214,2,163,4,213,2,202,
+4,163,4,170,1,202,4,163,4,157,2,202,4,163,4,214,
+2,163,4,187,3,202,4,163,4,129,1,202,4,163,4,157,
+2,202,4,163,4,214,2,163,4,186,3,135,4,137,4,209,
+6,202,4,136,5,223,3,135,4,137,4,218,6,240,3,223,
+3,137,4,219,6,153,5,220,4,137,4,79,80,81,82,83,
+223,3,163,4,145,2,152,4,159,6,175,4,185,4,163,4,
+179,2,214,2,214,2,223,3,240,3,242,4,163,4,163,3,
+185,4,240,3,242,4,163,4,165,3,185,4,240,3,226,3,
+242,4,163,4,166,3,185,4,226,3,250,5,240,3,202,4,
+163,4,214,2,202,4,163,4,165,2,252,5,202,4,163,4,
+170,1,202,4,163,4,157,2,202,4,163,4,214,2,163,4,
+213,2,202,4,163,4,170,1,202,4,163,4,157,2,202,4,
+163,4,214,2,163,4,166,3,202,4,163,4,129,1,202,4,
+163,4,157,2,202,4,163,4,214,2,163,4,165,3,85,86,
+223,3,163,4,145,2,152,4,159,6,175,4,185,4,163,4,
+179,2,214,2,214,2,223,3,240,3,250,5,163,4,214,2,
+163,4,165,2,243,6,244,6,190,3,245,6,163,4,170,1,
+243,6,244,6,156,1,245,6,243,6,244,6,160,1,245,6,
+137,4,254,6,137,4,134,7,203,4,227,3,228,3,137,4,
+149,7,137,4,156,7,203,4,227,3,228,3,9,94,9,95,
+9,96,9,97,9,98,9,99,9,100,9,101,9,102,9,103,
+9,104,9,105,9,106,0,9,107,9,108,9,109,9,110,9,
+111,9,112,9,113,9,114,9,115,9,116,221,2,9,117,9,
+117,9,118,9,118,9,119,9,119,9,120,9,120,9,121,9,
+121,9,122,9,122,9,123,9,123,9,124,9,124,9,125,9,
+125,9,126,9,126,9,127,9,127,9,128,1,9,128,1,9,
+129,1,9,129,1,9,130,1,9,130,1,9,131,1,9,131,
+1,9,132,1,9,132,1,9,133,1,9,133,1,9,134,1,
+9,134,1,9,135,1,9,135,1,9,136,1,9,136,1,9,
+137,1,9,137,1,9,138,1,9,138,1,9,139,1,9,139,
+1,9,140,1,9,140,1,9,141,1,9,141,1,9,142,1,
+9,142,1,9,143,1,9,143,1,9,144,1,9,144,1,9,
+145,1,9,145,1,9,146,1,9,146,1,9,147,1,9,147,
+1,9,148,1,9,148,1,9,149,1,9,149,1,9,150,1,
+9,150,1,9,151,1,9,151,1,9,152,1,9,152,1,9,
+153,1,9,153,1,9,154,1,9,154,1,9,155,1,9,155,
+1,9,156,1,9,156,1,9,157,1,9,157,1,9,158,1,
+9,158,1,9,159,1,9,159,1,9,160,1,9,160,1,9,
+161,1,9,161,1,9,162,1,9,162,1,9,163,1,9,163,
+1,9,164,1,9,164,1,9,165,1,9,165,1,9,166,1,
+9,166,1,9,167,1,9,167,1,9,168,1,9,168,1,9,
+169,1,9,169,1,9,170,1,9,170,1,9,171,1,9,171,
+1,9,172,1,9,172,1,9,173,1,9,173,1,9,174,1,
+9,174,1,9,175,1,9,175,1,9,176,1,9,176,1,9,
+177,1,9,177,1,9,178,1,9,178,1,9,179,1,9,179,
+1,9,180,1,9,180,1,9,181,1,9,181,1,9,182,1,
+9,182,1,9,183,1,9,183,1,9,184,1,9,184,1,9,
+185,1,9,185,1,9,186,1,9,186,1,9,187,1,9,187,
+1,9,188,1,9,188,1,9,189,1,9,189,1,9,190,1,
+9,190,1,9,191,1,9,191,1,9,192,1,9,192,1,9,
+193,1,9,193,1,9,194,1,9,194,1,9,195,1,9,195,
+1,9,196,1,9,196,1,9,197,1,9,197,1,9,198,1,
+9,198,1,9,199,1,9,199,1,9,200,1,9,200,1,9,
+201,1,9,201,1,9,202,1,9,202,1,9,203,1,9,203,
+1,9,204,1,9,204,1,9,205,1,9,205,1,9,206,1,
+9,206,1,9,207,1,9,207,1,9,208,1,9,208,1,9,
+209,1,9,209,1,9,210,1,9,210,1,9,211,1,9,211,
+1,9,212,1,9,212,1,9,213,1,9,213,1,9,214,1,
+9,214,1,9,215,1,9,215,1,9,216,1,9,216,1,9,
+217,1,9,217,1,9,218,1,9,218,1,9,219,1,9,219,
+1,9,220,1,9,220,1,9,221,1,9,221,1,9,222,1,
+9,222,1,9,223,1,9,223,1,9,224,1,9,224,1,9,
+225,1,9,225,1,9,226,1,9,226,1,9,227,1,9,227,
+1,9,228,1,9,228,1,9,229,1,9,229,1,9,230,1,
+9,230,1,9,231,1,9,231,1,9,232,1,9,232,1,9,
+233,1,9,233,1,9,234,1,9,234,1,9,235,1,9,235,
+1,9,236,1,9,236,1,9,237,1,9,237,1,9,238,1,
+9,238,1,9,239,1,9,239,1,9,240,1,9,240,1,9,
+241,1,9,241,1,9,242,1,9,242,1,9,243,1,9,243,
+1,9,244,1,9,244,1,9,245,1,9,245,1,9,246,1,
+9,246,1,9,247,1,9,247,1,9,248,1,9,248,1,9,
+249,1,9,249,1,9,250,1,9,250,1,9,251,1,9,251,
+1,9,252,1,9,252,1,9,253,1,9,253,1,9,254,1,
+9,254,1,9,255,1,9,255,1,9,128,2,9,128,2,9,
+129,2,9,129,2,9,130,2,9,130,2,9,131,2,9,131,
+2,9,132,2,9,132,2,9,133,2,9,133,2,9,134,2,
+9,134,2,9,135,2,9,135,2,9,136,2,9,136,2,9,
+137,2,9,137,2,9,138,2,9,138,2,9,139,2,9,139,
+2,9,140,2,9,140,2,9,141,2,9,141,2,9,142,2,
+9,142,2,9,143,2,9,143,2,9,144,2,9,144,2,9,
+145,2,9,145,2,9,146,2,9,146,2,9,147,2,9,147,
+2,9,148,2,9,148,2,9,149,2,9,149,2,9,150,2,
+9,150,2,9,151,2,9,151,2,9,152,2,9,152,2,9,
+153,2,9,153,2,9,154,2,9,154,2,9,155,2,9,155,
+2,9,156,2,9,156,2,9,157,2,9,157,2,9,158,2,
+9,158,2,9,159,2,9,159,2,9,160,2,9,160,2,9,
+161,2,9,161,2,9,162,2,9,162,2,9,163,2,9,163,
+2,9,164,2,9,164,2,9,165,2,9,165,2,9,166,2,
+9,166,2,9,167,2,9,167,2,9,168,2,9,168,2,9,
+169,2,9,169,2,9,170,2,9,170,2,9,171,2,9,171,
+2,9,172,2,9,172,2,9,173,2,9,173,2,9,174,2,
+9,174,2,9,175,2,9,175,2,9,176,2,9,176,2,9,
+177,2,9,177,2,9,178,2,9,178,2,9,179,2,9,179,
+2,9,180,2,9,180,2,9,181,2,9,181,2,9,182,2,
+9,182,2,9,183,2,9,183,2,9,184,2,9,184,2,9,
+185,2,9,185,2,9,186,2,9,186,2,9,187,2,9,187,
+2,9,188,2,9,188,2,9,189,2,9,189,2,9,190,2,
+9,190,2,9,191,2,9,191,2,9,192,2,9,192,2,9,
+193,2,9,193,2,9,194,2,9,194,2,9,195,2,9,195,
+2,9,196,2,9,196,2,9,197,2,9,197,2,9,198,2,
+9,198,2,9,199,2,9,199,2,9,200,2,9,200,2,9,
+201,2,9,201,2,9,202,2,9,202,2,9,203,2,9,203,
+2,9,204,2,9,204,2,9,205,2,9,205,2,9,206,2,
+9,206,2,9,207,2,9,207,2,9,208,2,9,208,2,9,
+209,2,9,209,2,9,210,2,9,210,2,9,211,2,9,211,
+2,9,212,2,9,212,2,9,213,2,9,213,2,9,214,2,
+9,214,2,9,215,2,9,215,2,9,216,2,9,216,2,9,
+217,2,9,217,2,9,218,2,9,218,2,9,219,2,9,219,
+2,9,220,2,9,220,2,9,221,2,9,221,2,9,222,2,
+9,222,2,9,223,2,9,223,2,9,224,2,9,224,2,9,
+225,2,9,225,2,9,226,2,9,226,2,9,227,2,9,227,
+2,9,228,2,9,228,2,9,229,2,9,229,2,9,230,2,
+9,230,2,9,231,2,9,231,2,9,232,2,9,232,2,9,
+233,2,9,233,2,9,234,2,9,234,2,9,235,2,9,235,
+2,9,236,2,9,236,2,9,237,2,9,237,2,9,238,2,
+9,238,2,9,239,2,9,239,2,9,240,2,9,240,2,9,
+241,2,9,241,2,9,242,2,9,242,2,9,243,2,9,243,
+2,9,244,2,9,244,2,9,245,2,9,245,2,9,246,2,
+9,246,2,9,247,2,9,247,2,9,248,2,9,248,2,9,
+249,2,9,249,2,9,250,2,9,250,2,9,251,2,9,251,
+2,9,252,2,9,252,2,9,253,2,9,253,2,9,254,2,
+9,254,2,9,255,2,9,255,2,9,128,3,9,128,3,9,
+129,3,9,129,3,9,130,3,9,130,3,9,131,3,9,131,
+3,9,132,3,9,132,3,9,133,3,9,133,3,9,134,3,
+9,134,3,9,135,3,9,135,3,9,136,3,9,136,3,9,
+137,3,9,137,3,9,138,3,9,138,3,9,139,3,9,139,
+3,9,140,3,9,140,3,9,141,3,9,141,3,9,142,3,
+9,142,3,9,143,3,9,143,3,9,144,3,9,144,3,9,
+145,3,9,145,3,9,146,3,9,146,3,9,147,3,9,147,
+3,9,148,3,9,148,3,9,149,3,9,149,3,9,150,3,
+9,150,3,9,151,3,9,151,3,9,152,3,9,152,3,9,
+153,3,9,153,3,9,154,3,9,154,3,9,155,3,9,155,
+3,9,156,3,9,156,3,9,157,3,9,157,3,9,158,3,
+9,158,3,9,159,3,9,159,3,9,160,3,9,160,3,9,
+161,3,9,161,3,9,162,3,9,162,3,9,163,3,9,163,
+3,9,164,3,9,164,3,9,165,3,9,165,3,9,166,3,
+9,166,3,9,167,3,9,167,3,9,168,3,9,168,3,9,
+169,3,9,169,3,9,170,3,9,170,3,9,171,3,9,171,
+3,9,172,3,9,172,3,9,173,3,9,173,3,9,174,3,
+9,174,3,9,175,3,9,175,3,9,176,3,9,176,3,9,
+177,3,9,177,3,9,178,3,9,178,3,9,179,3,9,179,
+3,9,180,3,9,180,3,9,181,3,9,181,3,9,182,3,
+9,182,3,9,183,3,9,183,3,9,184,3,9,184,3,9,
+185,3,9,185,3,9,186,3,9,186,3,9,187,3,9,187,
+3,9,188,3,9,188,3,9,189,3,9,189,3,9,190,3,
+9,190,3,9,191,3,9,191,3,9,192,3,9,192,3,9,
+193,3,9,193,3,9,194,3,9,194,3,9,195,3,9,195,
+3,9,196,3,9,196,3,9,197,3,9,197,3,9,198,3,
+9,198,3,9,199,3,9,199,3,9,200,3,9,200,3,9,
+201,3,9,201,3,9,202,3,9,202,3,9,203,3,9,203,
+3,9,204,3,9,204,3,9,205,3,9,205,3,9,206,3,
+9,206,3,9,207,3,9,207,3,9,208,3,9,208,3,9,
+209,3,9,209,3,9,210,3,9,211,3,9,212,3,9,213,
+3,9,214,3,9,215,3,9,216,3,9,217,3,9,230,3,
+9,231,3,9,232,3,9,233,3,9,118,9,234,3,9,235,
+3,9,236,3,9,237,3,9,238,3,0,9,239,3,9,241,
+3,9,108,9,242,3,9,243,3,0,9,244,3,9,249,3,
+9,250,3,9,251,3,9,252,3,9,119,9,253,3,9,254,
+3,9,255,3,9,111,9,111,9,128,4,9,129,4,0,9,
+225,3,9,130,4,9,131,4,9,132,4,0,9,133,4,9,
+141,4,9,142,4,9,143,4,9,144,4,9,123,9,145,4,
+9,146,4,9,147,4,9,230,3,9,230,3,9,148,4,9,
+149,4,9,150,4,9,163,4,9,164,4,9,165,4,9,166,
+4,0,9,167,4,9,177,4,9,178,4,9,179,4,9,180,
+4,9,124,9,177,4,9,181,4,9,182,4,9,249,3,9,
+249,3,9,183,4,0,0,9,184,4,9,227,3,9,186,4,
+9,187,4,9,188,4,0,9,189,4,9,191,4,9,192,4,
+9,193,4,9,194,4,9,128,1,9,191,4,9,195,4,9,
+196,4,9,141,4,9,141,4,0,134,1,108,9,197,4,9,
+198,4,9,199,4,9,200,4,0,9,201,4,9,204,4,9,
+205,4,9,206,4,9,207,4,9,129,1,9,228,3,9,208,
+4,9,209,4,210,4,108,9,211,4,9,212,4,9,213,4,
+9,214,4,0,9,215,4,9,216,4,9,217,4,9,218,4,
+9,219,4,9,130,1,9,220,4,9,221,4,9,222,4,223,
+4,108,9,224,4,9,225,4,9,226,4,9,227,4,0,9,
+228,4,9,229,4,9,230,4,9,231,4,9,232,4,9,132,
+1,9,175,4,9,233,4,9,234,4,235,4,108,9,236,4,
+9,237,4,9,238,4,9,239,4,0,9,240,4,9,244,4,
+9,245,4,9,246,4,9,247,4,9,134,1,9,204,4,9,
+248,4,9,249,4,250,4,108,9,251,4,9,252,4,9,253,
+4,9,254,4,0,9,255,4,9,129,5,9,130,5,9,131,
+5,9,132,5,9,210,4,9,134,1,9,133,5,9,134,5,
+135,5,108,9,136,5,9,137,5,9,138,5,9,139,5,0,
+9,140,5,9,146,5,9,147,5,9,148,5,9,149,5,9,
+223,4,9,176,1,9,150,5,9,151,5,152,5,108,9,153,
+5,9,154,5,9,155,5,9,156,5,0,9,157,5,9,162,
+5,9,163,5,9,164,5,9,165,5,9,235,4,9,177,1,
+9,166,5,9,167,5,168,5,108,9,142,5,9,169,5,9,
+170,5,9,171,5,0,9,172,5,9,175,5,9,176,5,9,
+177,5,9,178,5,9,250,4,9,138,2,9,179,5,9,180,
+5,176,1,108,9,160,5,9,181,5,9,182,5,9,183,5,
+0,9,184,5,9,186,5,9,187,5,9,188,5,9,189,5,
+9,135,5,9,143,2,9,190,5,9,191,5,177,1,108,9,
+203,4,9,192,5,9,193,5,9,194,5,0,9,195,5,9,
+198,5,9,199,5,9,200,5,9,201,5,9,152,5,9,214,
+2,9,202,5,9,203,5,138,2,108,9,143,5,9,204,5,
+9,205,5,9,206,5,0,9,207,5,9,209,5,9,210,5,
+9,211,5,9,212,5,9,168,5,9,131,3,9,213,5,9,
+214,5,143,2,108,9,243,4,9,215,5,9,216,5,9,217,
+5,0,9,218,5,9,220,5,9,221,5,9,222,5,9,223,
+5,9,151,1,9,226,3,9,224,5,9,225,5,214,2,108,
+9,197,5,9,226,5,9,227,5,0,0,9,228,5,9,230,
+5,9,231,5,9,232,5,9,233,5,9,152,1,9,223,3,
+9,234,5,9,235,5,131,3,108,9,236,5,9,237,5,0,
+9,238,5,9,241,5,9,242,5,9,243,5,9,244,5,9,
+245,5,9,216,4,9,246,5,9,247,5,9,248,5,0,9,
+253,5,9,255,5,9,128,6,9,129,6,9,130,6,9,156,
+1,9,254,5,9,131,6,9,132,6,0,0,9,133,6,9,
+134,6,9,135,6,9,136,6,9,137,6,9,157,1,9,229,
+4,9,138,6,9,139,6,0,9,140,6,9,141,6,9,142,
+6,9,143,6,9,144,6,9,158,1,9,229,3,9,145,6,
+9,146,6,0,9,147,6,9,148,6,9,149,6,9,150,6,
+9,151,6,9,159,1,9,245,3,9,152,6,9,153,6,0,
+9,154,6,9,155,6,9,156,6,9,157,6,9,158,6,9,
+160,1,9,159,6,9,160,6,9,161,6,0,9,162,6,9,
+163,6,9,164,6,9,165,6,9,166,6,9,164,1,9,160,
+4,9,167,6,9,168,6,0,9,169,6,9,170,6,9,171,
+6,9,172,6,9,173,6,9,174,6,9,213,3,9,175,6,
+9,176,6,0,9,177,6,9,178,6,9,179,6,9,180,6,
+9,181,6,9,169,1,9,244,4,9,182,6,9,183,6,0,
+9,184,6,9,186,6,9,187,6,9,188,6,9,189,6,9,
+111,9,111,9,190,6,9,191,6,0,9,192,6,9,193,6,
+9,194,6,9,195,6,9,196,6,9,170,1,9,197,6,9,
+198,6,9,199,6,0,9,200,6,9,201,6,9,202,6,9,
+203,6,9,204,6,9,171,1,9,205,6,9,206,6,9,207,
+6,0,9,208,6,9,210,6,9,211,6,9,212,6,9,213,
+6,9,172,1,9,214,6,9,215,6,9,216,6,0,9,217,
+6,9,220,6,9,221,6,9,222,6,9,223,6,9,173,1,
+9,224,6,9,225,6,9,226,6,0,9,227,6,9,228,6,
+9,229,6,9,230,6,9,231,6,9,175,1,9,232,6,9,
+233,6,9,234,6,0,9,235,6,9,236,6,9,237,6,9,
+238,6,9,239,6,9,176,1,9,129,5,9,240,6,9,241,
+6,0,9,242,6,9,246,6,9,247,6,9,248,6,9,249,
+6,9,250,6,9,146,5,9,251,6,9,252,6,0,9,253,
+6,9,255,6,9,128,7,9,129,7,9,130,7,9,230,3,
+9,230,3,9,131,7,9,132,7,0,9,133,7,9,135,7,
+9,136,7,9,137,7,9,138,7,9,177,1,9,162,5,9,
+139,7,9,140,7,0,9,141,7,9,142,7,9,143,7,9,
+144,7,9,145,7,9,178,1,9,175,5,9,146,7,9,147,
+7,0,9,148,7,9,150,7,9,151,7,9,152,7,0,9,
+179,1,9,186,5,9,153,7,9,154,7,0,9,155,7,9,
+157,7,9,158,7,9,190,1,9,198,5,9,159,7,9,160,
+7,0,9,161,7,9,193,1,9,209,5,9,162,7,9,163,
+7,0,9,196,1,9,218,3,9,164,7,9,165,7,9,198,
+1,9,221,3,9,166,7,9,167,7,9,199,1,9,137,4,
+9,168,7,9,169,7,9,205,1,9,248,3,9,170,7,9,
+171,7,9,207,1,9,155,4,9,172,7,9,173,7,9,249,
+3,9,249,3,9,174,7,9,175,7,9,242,1,9,220,3,
+9,176,7,9,177,7,9,243,1,9,224,3,9,178,7,9,
+179,7,9,245,1,9,247,3,9,180,7,9,181,7,9,182,
+7,9,241,3,9,183,7,9,184,7,9,136,2,9,242,4,
+9,185,7,9,186,7,9,137,2,9,240,3,9,187,7,9,
+188,7,9,138,2,9,220,5,9,189,7,9,190,7,9,141,
+4,9,141,4,9,191,7,9,192,7,9,143,2,9,230,5,
+9,193,7,9,194,7,9,144,2,9,135,4,9,195,7,9,
+196,7,9,145,2,9,241,5,9,197,7,9,198,7,9,146,
+2,9,255,5,9,199,7,9,200,7,9,147,2,9,134,6,
+9,201,7,9,202,7,9,148,2,9,141,6,9,203,7,9,
+204,7,9,149,2,9,148,6,9,205,7,9,206,7,9,150,
+2,9,155,6,9,207,7,9,208,7,9,151,2,9,163,6,
+9,209,7,9,210,7,9,152,2,9,170,6,9,211,7,9,
+212,7,9,154,2,9,140,4,9,213,7,9,214,7,9,155,
+2,9,173,4,9,215,7,9,216,7,9,156,2,9,176,4,
+9,217,7,9,218,7,9,157,2,9,202,4,9,219,7,9,
+220,7,9,165,2,9,251,5,9,221,7,9,222,7,9,167,
+2,9,139,4,9,223,7,9,224,7,9,170,2,9,134,4,
+9,225,7,9,226,7,9,173,2,9,249,5,9,227,7,9,
+228,7,9,179,2,9,185,4,9,229,7,9,230,7,9,182,
+2,9,246,3,9,231,7,9,232,7,9,233,7,9,225,3,
+9,234,7,9,235,7,9,192,2,9,152,4,9,236,7,9,
+237,7,9,194,2,9,219,3,9,238,7,9,239,7,9,196,
+2,9,240,7,9,241,7,9,242,7,9,197,2,9,243,7,
+9,244,7,9,245,7,9,198,2,9,157,4,9,246,7,9,
+247,7,9,199,2,9,154,4,9,248,7,9,249,7,9,204,
+2,9,178,6,9,250,7,9,251,7,9,206,2,9,252,7,
+9,253,7,9,254,7,9,207,2,9,186,6,9,255,7,9,
+128,8,9,213,2,9,193,6,9,129,8,9,130,8,9,214,
+2,9,201,6,9,131,8,9,132,8,9,131,3,9,210,6,
+9,133,8,9,134,8,9,136,3,9,135,8,9,136,8,9,
+137,8,9,137,3,9,168,4,9,138,8,9,139,8,9,139,
+3,9,162,4,9,140,8,9,141,8,9,144,3,9,159,4,
+9,142,8,9,143,8,9,159,3,9,158,4,9,144,8,9,
+145,8,9,161,3,9,146,8,9,147,8,9,148,8,9,162,
+3,9,220,6,9,149,8,9,150,8,9,163,3,9,228,6,
+9,151,8,9,152,8,9,164,3,9,236,6,9,153,8,9,
+154,8,9,165,3,9,246,6,9,155,8,9,156,8,9,166,
+3,9,255,6,9,157,8,9,158,8,9,159,8,9,163,4,
+9,160,8,9,161,8,9,162,8,9,227,3,9,163,8,9,
+164,8,9,165,8,9,197,4,9,166,8,9,167,8,9,168,
+8,9,211,4,9,169,8,9,170,8,9,171,8,9,224,4,
+9,172,8,9,173,8,9,174,8,9,236,4,9,175,8,9,
+176,8,9,177,8,9,251,4,9,178,8,9,179,8,9,180,
+8,9,136,5,9,181,8,9,182,8,9,183,8,9,153,5,
+9,184,8,9,185,8,9,186,8,9,142,5,9,187,8,9,
+188,8,9,189,8,9,160,5,9,190,8,9,191,8,9,192,
+8,9,203,4,9,193,8,9,194,8,9,195,8,9,143,5,
+9,196,8,9,197,8,9,198,8,9,243,4,9,199,8,9,
+200,8,9,201,8,9,197,5,9,202,8,9,203,8,9,185,
+5,9,236,5,9,204,8,9,205,8,9,185,3,9,135,7,
+9,206,8,9,207,8,9,186,3,9,142,7,9,208,8,9,
+209,8,9,187,3,9,150,7,9,210,8,9,211,8,9,190,
+3,9,252,5,9,212,8,9,213,8,9,201,3,9,250,5,
+9,214,8,0,9,202,3,9,157,7,9,93,
+};
+
 void
 pic_boot(pic_state *pic)
 {
-  pic_load_cstr(pic, &boot_rom[0][0]);
+  if (! pic_restore(pic, boot_image, sizeof boot_image)) {
+    pic_load_cstr(pic, &boot_rom[0][0]);
+  }
 }
 
 #if 0
@@ -0,0 +1,1448 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/private/object.h"
+#include "picrin/private/state.h"
+#include "picrin/private/vm.h"
+
+/* object graph serialization.
+
+   An image is a header, a table of objects, and the root value. Ireps
+   have entries of their own and precede the other objects, so that a
+   closure finds its irep already made. The table is written in two
+   passes: first the shape of each entry (its type and whatever it takes to
+   allocate it), then its references to other entries. The reader makes
+   every object before filling in any, which takes care of cycles. Numbers
+   are written byte by byte, so an image does not depend on the host.
+
+   Symbols are written by name and interned again when read. Library
+   environments and procedures defined in C are written by name too and
+   must exist in the state that reads the image. Ports, data, errors, weak
+   tables and continuations cannot be written.
+
+   The bytecode itself is trusted: the reader checks that an irep's
+   operands stay inside its own tables but does not verify the code. */
+
+#define DUMP_MAGIC "\0PICIMG"
+#define DUMP_VERSION 1          /* bump whenever the instruction set changes */
+
+enum {
+  V_NIL, V_TRUE, V_FALSE, V_UNDEF, V_EOF, V_INVALID, V_INT, V_FLOAT, V_CHAR, V_REF
+};
+
+enum {
+  O_IREP, O_SYMBOL, O_USYMBOL, O_STRING, O_BLOB, O_BIGNUM, O_PAIR, O_VECTOR, O_ID,
+  O_LIBENV, O_ENV, O_DICT, O_RECORD, O_TABLE, O_PROC, O_CXT, O_NATIVE
+};
+
+KHASH_DECLARE(dump, void *, int)
+KHASH_DEFINE(dump, void *, int, kh_ptr_hash_func, kh_ptr_hash_equal)
+
+/* hash table entries in name order, so that an image does not depend on
+   heap addresses */
+struct entry {
+  const char *name, *name2;     /* sort keys */
+  pic_value key, val;
+};
+
+struct entries {
+  struct entry *e, *tmp;
+  int n, capa;
+};
+
+struct dumper {
+  xFILE *file;
+  khash_t(dump) index;          /* ~n for the n-th irep, n for the n-th object */
+  khash_t(weak) natives;        /* native procedure to its global name */
+  pic_value owned;              /* uninterned variables the image defines, or #f */
+  struct irep **ireps;
+  struct object **objs;
+  int nirep, nobj, irepcapa, objcapa;
+  struct entries ents;          /* scratch for dictionaries and environments */
+};
+
+static void
+add_entry(pic_state *pic, struct entries *es, const char *name, const char *name2, pic_value key, pic_value val)
+{
+  if (es->n == es->capa) {
+    es->capa = es->capa * 2 + 16;
+    es->e = pic_realloc(pic, es->e, sizeof(struct entry) * es->capa);
+    es->tmp = pic_realloc(pic, es->tmp, sizeof(struct entry) * es->capa);
+  }
+  es->e[es->n].name = name;
+  es->e[es->n].name2 = name2;
+  es->e[es->n].key = key;
+  es->e[es->n].val = val;
+  es->n++;
+}
+
+static int
+entry_cmp(const struct entry *a, const struct entry *b)
+{
+  int r = strcmp(a->name, b->name);
+
+  return r != 0 ? r : strcmp(a->name2, b->name2);
+}
+
+/* merge sort, as qsort is not there without libc */
+static void
+sort_entries(struct entry *e, struct entry *tmp, int n)
+{
+  int i, j, k, m = n / 2;
+
+  if (n < 2) {
+    return;
+  }
+  sort_entries(e, tmp, m);
+  sort_entries(e + m, tmp, n - m);
+  for (i = 0, j = m, k = 0; k < n; ++k) {
+    tmp[k] = (j == n || (i < m && entry_cmp(&e[i], &e[j]) <= 0)) ? e[i++] : e[j++];
+  }
+  memcpy(e, tmp, sizeof(struct entry) * n);
+}
+
+static void
+free_entries(pic_state *pic, struct entries *es)
+{
+  pic_free(pic, es->e);
+  pic_free(pic, es->tmp);
+}
+
+static void
+env_entries(pic_state *pic, struct entries *es, struct env *env)
+{
+  pic_value key, val;
+  int it;
+
+  es->n = 0;
+  for (it = kh_begin(&env->map); it != kh_end(&env->map); ++it) {
+    if (kh_exist(&env->map, it)) {
+      key = pic_obj_value(kh_key(&env->map, it));
+      val = pic_obj_value(kh_val(&env->map, it));
+      add_entry(pic, es, pic_str(pic, pic_id_name(pic, key)), pic_sym(pic, val), key, val);
+    }
+  }
+  sort_entries(es->e, es->tmp, es->n);
+}
+
+static void
+dict_entries(pic_state *pic, struct entries *es, pic_value dict)
+{
+  pic_value key, val;
+  int it = 0;
+
+  es->n = 0;
+  while (pic_dict_next(pic, dict, &it, &key, &val)) {
+    add_entry(pic, es, pic_sym(pic, key), "", key, val);
+  }
+  sort_entries(es->e, es->tmp, es->n);
+}
+
+static void
+put_byte(pic_state *pic, struct dumper *d, int c)
+{
+  xfputc(pic, c, d->file);
+}
+
+static void
+put_uint(pic_state *pic, struct dumper *d, uint64_t n)
+{
+  while (n >= 0x80) {
+    put_byte(pic, d, (int)(n & 0x7f) | 0x80);
+    n >>= 7;
+  }
+  put_byte(pic, d, (int)n);
+}
+
+static void
+put_int(pic_state *pic, struct dumper *d, int64_t n)
+{
+  put_uint(pic, d, n < 0 ? ~((uint64_t)n << 1) : (uint64_t)n << 1);
+}
+
+static void
+put_float(pic_state *pic, struct dumper *d, double f)
+{
+  uint64_t w;
+  int i;
+
+  memcpy(&w, &f, sizeof w);
+  for (i = 0; i < 8; ++i) {
+    put_byte(pic, d, (int)(w >> (i * 8)) & 0xff);
+  }
+}
+
+static void
+put_bytes(pic_state *pic, struct dumper *d, const void *buf, int len)
+{
+  put_uint(pic, d, len);
+  xfwrite(pic, buf, 1, len, d->file);
+}
+
+static void
+put_str(pic_state *pic, struct dumper *d, pic_value str)
+{
+  put_bytes(pic, d, pic_str(pic, str), pic_str_nbytes(pic, str));
+}
+
+static void
+put_ref(pic_state *pic, struct dumper *d, void *ptr)
+{
+  int it = kh_get(dump, &d->index, ptr), n;
+
+  assert(it != kh_end(&d->index));
+  n = kh_val(&d->index, it);
+
+  put_uint(pic, d, n < 0 ? ~n : d->nirep + n);
+}
+
+static void
+put_value(pic_state *pic, struct dumper *d, pic_value v)
+{
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_NIL: put_byte(pic, d, V_NIL); break;
+  case PIC_TYPE_TRUE: put_byte(pic, d, V_TRUE); break;
+  case PIC_TYPE_FALSE: put_byte(pic, d, V_FALSE); break;
+  case PIC_TYPE_UNDEF: put_byte(pic, d, V_UNDEF); break;
+  case PIC_TYPE_EOF: put_byte(pic, d, V_EOF); break;
+  case PIC_TYPE_INVALID: put_byte(pic, d, V_INVALID); break;
+  case PIC_TYPE_INT:
+    put_byte(pic, d, V_INT);
+    put_int(pic, d, pic_fixnum(pic, v));
+    break;
+  case PIC_TYPE_FLOAT:
+    put_byte(pic, d, V_FLOAT);
+    put_float(pic, d, pic_float(pic, v));
+    break;
+  case PIC_TYPE_CHAR:
+    put_byte(pic, d, V_CHAR);
+    put_uint(pic, d, pic_char(pic, v));
+    break;
+  default:
+    put_byte(pic, d, V_REF);
+    put_ref(pic, d, pic_obj_ptr(v));
+    break;
+  }
+}
+
+static bool
+libenv_p(struct env *env)
+{
+  return env->lib != NULL;
+}
+
+static bool
+interned_p(pic_state *pic, symbol *sym)
+{
+  int it = kh_get(oblist, &pic->oblist, sym->u.str);
+
+  return it != kh_end(&pic->oblist) && kh_val(&pic->oblist, it) == sym;
+}
+
+static void
+index_natives(pic_state *pic, khash_t(weak) *natives)
+{
+  khash_t(weak) *h = &pic_weak_ptr(pic, pic->globals)->hash;
+  struct object *key;
+  pic_value val;
+  int it, it2, ret;
+
+  for (it = kh_begin(h); it != kh_end(h); ++it) {
+    if (! kh_exist(h, it)) {
+      continue;
+    }
+    key = kh_key(h, it);
+    val = kh_val(h, it);
+    if (! pic_func_p(pic, val) || ! interned_p(pic, (symbol *)key)) {
+      continue;
+    }
+    it2 = kh_put(weak, natives, pic_obj_ptr(val), &ret);
+    /* a procedure bound to several names cannot be told from its aliases */
+    kh_val(natives, it2) = ret == 0 ? pic_invalid_value(pic) : pic_obj_value(key);
+  }
+}
+
+static pic_value
+native_name(pic_state *pic, struct dumper *d, struct object *proc)
+{
+  int it = kh_get(weak, &d->natives, proc);
+
+  if (it == kh_end(&d->natives) || pic_invalid_p(pic, kh_val(&d->natives, it))) {
+    pic_error(pic, "dump: procedure defined in C has no unique global name", 1, pic_obj_value(proc));
+  }
+  if (((struct proc *)proc)->u.f.localc != 0) {
+    pic_error(pic, "dump: cannot write procedure defined in C with local values", 1, pic_obj_value(proc));
+  }
+  return pic_sym_name(pic, kh_val(&d->natives, it));
+}
+
+/* collect */
+
+static void
+visit(pic_state *pic, struct dumper *d, void *ptr, bool irep)
+{
+  int it, ret;
+
+  it = kh_put(dump, &d->index, ptr, &ret);
+  if (ret == 0) {
+    return;
+  }
+  if (irep) {
+    if (d->nirep == d->irepcapa) {
+      d->irepcapa = d->irepcapa * 2 + 16;
+      d->ireps = pic_realloc(pic, d->ireps, sizeof(struct irep *) * d->irepcapa);
+    }
+    kh_val(&d->index, it) = ~d->nirep;
+    d->ireps[d->nirep++] = ptr;
+  } else {
+    if (d->nobj == d->objcapa) {
+      d->objcapa = d->objcapa * 2 + 16;
+      d->objs = pic_realloc(pic, d->objs, sizeof(struct object *) * d->objcapa);
+    }
+    kh_val(&d->index, it) = d->nobj;
+    d->objs[d->nobj++] = ptr;
+  }
+}
+
+static void
+visit_value(pic_state *pic, struct dumper *d, pic_value v)
+{
+  if (pic_obj_p(pic, v) && ! pic_float_p(pic, v)) {
+    visit(pic, d, pic_obj_ptr(v), false);
+  }
+}
+
+static void
+collect_irep(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  size_t i;
+
+  for (i = 0; i < irep->nirep; ++i) {
+    visit(pic, d, irep->irep[i], true);
+  }
+  for (i = 0; i < irep->npool; ++i) {
+    visit(pic, d, irep->pool[i], false);
+  }
+}
+
+static void
+collect(pic_state *pic, struct dumper *d, struct object *obj)
+{
+  pic_value v = pic_obj_value(obj), key, val;
+  int i, it;
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_SYMBOL:
+    /* an uninterned variable read back is another variable */
+    if (! pic_false_p(pic, d->owned) && ! interned_p(pic, (symbol *)obj) && ! pic_dict_has(pic, d->owned, v)
+        && (pic_weak_has(pic, pic->globals, v) || pic_weak_has(pic, pic->macros, v))) {
+      pic_error(pic, "dump: variable is defined outside of the image", 1, v);
+    }
+    break;
+  case PIC_TYPE_STRING:
+  case PIC_TYPE_BLOB:
+  case PIC_TYPE_BIGNUM:
+    break;
+  case PIC_TYPE_PAIR:
+    visit_value(pic, d, pic_car(pic, v));
+    visit_value(pic, d, pic_cdr(pic, v));
+    break;
+  case PIC_TYPE_VECTOR:
+    for (i = 0; i < pic_vec_len(pic, v); ++i) {
+      visit_value(pic, d, pic_vec_ref(pic, v, i));
+    }
+    break;
+  case PIC_TYPE_ID:
+    visit(pic, d, ((struct identifier *)obj)->u.id, false);
+    visit(pic, d, ((struct identifier *)obj)->env, false);
+    break;
+  case PIC_TYPE_ENV: {
+    struct env *env = (struct env *)obj;
+    if (libenv_p(env)) {
+      break;
+    }
+    if (env->up) {
+      visit(pic, d, env->up, false);
+    }
+    env_entries(pic, &d->ents, env);
+    for (i = 0; i < d->ents.n; ++i) {
+      visit_value(pic, d, d->ents.e[i].key);
+      visit_value(pic, d, d->ents.e[i].val);
+    }
+    break;
+  }
+  case PIC_TYPE_DICT:
+    dict_entries(pic, &d->ents, v);
+    for (i = 0; i < d->ents.n; ++i) {
+      visit_value(pic, d, d->ents.e[i].key);
+      visit_value(pic, d, d->ents.e[i].val);
+    }
+    break;
+  case PIC_TYPE_RECORD:
+    visit_value(pic, d, ((struct record *)obj)->type);
+    visit_value(pic, d, ((struct record *)obj)->datum);
+    break;
+  case PIC_TYPE_TABLE:
+    if (((struct table *)obj)->weak) {
+      pic_error(pic, "dump: cannot write weak hash table", 1, v);
+    }
+    it = 0;
+    while (pic_table_next(pic, v, &it, &key, &val)) {
+      visit_value(pic, d, key);
+      visit_value(pic, d, val);
+    }
+    break;
+  case PIC_TYPE_IREP:
+    visit(pic, d, ((struct proc *)obj)->u.i.irep, true);
+    if (((struct proc *)obj)->u.i.cxt) {
+      visit(pic, d, ((struct proc *)obj)->u.i.cxt, false);
+    }
+    break;
+  case PIC_TYPE_CXT: {
+    struct context *cxt = (struct context *)obj;
+    if (cxt->regs != cxt->storage) {
+      pic_error(pic, "dump: cannot write the frame of a running procedure", 0);
+    }
+    for (i = 0; i < cxt->regc; ++i) {
+      visit_value(pic, d, cxt->regs[i]);
+    }
+    if (cxt->up) {
+      visit(pic, d, cxt->up, false);
+    }
+    break;
+  }
+  case PIC_TYPE_FUNC:
+    visit_value(pic, d, native_name(pic, d, obj));
+    break;
+  default:
+    pic_error(pic, "dump: cannot write object", 1, v);
+  }
+}
+
+/* write */
+
+static void
+put_irep_shape(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  size_t i;
+
+  put_byte(pic, d, O_IREP);
+  put_uint(pic, d, irep->argc);
+  put_uint(pic, d, irep->localc);
+  put_uint(pic, d, irep->capturec);
+  put_byte(pic, d, irep->varg);
+  put_uint(pic, d, irep->ncode);
+  for (i = 0; i < irep->ncode; ++i) {
+    put_uint(pic, d, irep->code[i].insn);
+    put_int(pic, d, irep->code[i].a);
+    put_int(pic, d, irep->code[i].b);
+  }
+  put_uint(pic, d, irep->nints);
+  for (i = 0; i < irep->nints; ++i) {
+    put_int(pic, d, irep->ints[i]);
+  }
+  put_uint(pic, d, irep->nnums);
+  for (i = 0; i < irep->nnums; ++i) {
+    put_float(pic, d, irep->nums[i]);
+  }
+  put_uint(pic, d, irep->nirep);
+  put_uint(pic, d, irep->npool);
+}
+
+static void
+put_shape(pic_state *pic, struct dumper *d, struct object *obj)
+{
+  pic_value v = pic_obj_value(obj);
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_SYMBOL:
+    put_byte(pic, d, interned_p(pic, (symbol *)obj) ? O_SYMBOL : O_USYMBOL);
+    put_str(pic, d, pic_sym_name(pic, v));
+    break;
+  case PIC_TYPE_STRING:
+    put_byte(pic, d, O_STRING);
+    put_str(pic, d, v);
+    break;
+  case PIC_TYPE_BLOB: {
+    unsigned char *buf;
+    int len;
+    buf = pic_blob(pic, v, &len);
+    put_byte(pic, d, O_BLOB);
+    put_bytes(pic, d, buf, len);
+    break;
+  }
+  case PIC_TYPE_BIGNUM:
+    put_byte(pic, d, O_BIGNUM);
+    put_str(pic, d, pic_big_to_string(pic, v, 16));
+    break;
+  case PIC_TYPE_PAIR:
+    put_byte(pic, d, O_PAIR);
+    break;
+  case PIC_TYPE_VECTOR:
+    put_byte(pic, d, O_VECTOR);
+    put_uint(pic, d, pic_vec_len(pic, v));
+    break;
+  case PIC_TYPE_ID:
+    put_byte(pic, d, O_ID);
+    break;
+  case PIC_TYPE_ENV:
+    if (libenv_p((struct env *)obj)) {
+      put_byte(pic, d, O_LIBENV);
+      put_str(pic, d, pic_obj_value(((struct env *)obj)->lib));
+    } else {
+      put_byte(pic, d, O_ENV);
+    }
+    break;
+  case PIC_TYPE_DICT:
+    put_byte(pic, d, O_DICT);
+    break;
+  case PIC_TYPE_RECORD:
+    put_byte(pic, d, O_RECORD);
+    break;
+  case PIC_TYPE_TABLE:
+    put_byte(pic, d, O_TABLE);
+    put_uint(pic, d, ((struct table *)obj)->kind);
+    break;
+  case PIC_TYPE_IREP:
+    put_byte(pic, d, O_PROC);
+    put_ref(pic, d, ((struct proc *)obj)->u.i.irep);
+    break;
+  case PIC_TYPE_CXT:
+    put_byte(pic, d, O_CXT);
+    put_uint(pic, d, ((struct context *)obj)->regc);
+    break;
+  case PIC_TYPE_FUNC:
+    put_byte(pic, d, O_NATIVE);
+    put_str(pic, d, native_name(pic, d, obj));
+    break;
+  default:
+    PIC_UNREACHABLE();
+  }
+}
+
+static void
+put_irep_fill(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  size_t i;
+
+  for (i = 0; i < irep->nirep; ++i) {
+    put_ref(pic, d, irep->irep[i]);
+  }
+  for (i = 0; i < irep->npool; ++i) {
+    put_ref(pic, d, irep->pool[i]);
+  }
+}
+
+static void
+put_fill(pic_state *pic, struct dumper *d, struct object *obj)
+{
+  pic_value v = pic_obj_value(obj);
+  int i;
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_PAIR:
+    put_value(pic, d, pic_car(pic, v));
+    put_value(pic, d, pic_cdr(pic, v));
+    break;
+  case PIC_TYPE_VECTOR:
+    for (i = 0; i < pic_vec_len(pic, v); ++i) {
+      put_value(pic, d, pic_vec_ref(pic, v, i));
+    }
+    break;
+  case PIC_TYPE_ID:
+    put_ref(pic, d, ((struct identifier *)obj)->u.id);
+    put_ref(pic, d, ((struct identifier *)obj)->env);
+    break;
+  case PIC_TYPE_ENV: {
+    struct env *env = (struct env *)obj;
+    if (libenv_p(env)) {
+      break;
+    }
+    put_value(pic, d, env->up ? pic_obj_value(env->up) : pic_nil_value(pic));
+    env_entries(pic, &d->ents, env);
+    put_uint(pic, d, d->ents.n);
+    for (i = 0; i < d->ents.n; ++i) {
+      put_ref(pic, d, pic_obj_ptr(d->ents.e[i].key));
+      put_ref(pic, d, pic_obj_ptr(d->ents.e[i].val));
+    }
+    break;
+  }
+  case PIC_TYPE_DICT:
+    dict_entries(pic, &d->ents, v);
+    put_uint(pic, d, d->ents.n);
+    for (i = 0; i < d->ents.n; ++i) {
+      put_value(pic, d, d->ents.e[i].key);
+      put_value(pic, d, d->ents.e[i].val);
+    }
+    break;
+  case PIC_TYPE_RECORD:
+    put_value(pic, d, ((struct record *)obj)->type);
+    put_value(pic, d, ((struct record *)obj)->datum);
+    break;
+  case PIC_TYPE_IREP: {
+    struct context *cxt = ((struct proc *)obj)->u.i.cxt;
+    put_value(pic, d, cxt ? pic_obj_value(cxt) : pic_nil_value(pic));
+    break;
+  }
+  case PIC_TYPE_CXT: {
+    struct context *cxt = (struct context *)obj;
+    put_value(pic, d, cxt->up ? pic_obj_value(cxt->up) : pic_nil_value(pic));
+    for (i = 0; i < cxt->regc; ++i) {
+      put_value(pic, d, cxt->regs[i]);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+/* tables go last, as an equal table hashes its keys' contents */
+static void
+put_table_fill(pic_state *pic, struct dumper *d, struct object *obj)
+{
+  pic_value key, val;
+  int it = 0;
+
+  put_uint(pic, d, pic_table_size(pic, pic_obj_value(obj)));
+  while (pic_table_next(pic, pic_obj_value(obj), &it, &key, &val)) {
+    put_value(pic, d, key);
+    put_value(pic, d, val);
+  }
+}
+
+static void
+dump(pic_state *pic, struct dumper *d, pic_value obj)
+{
+  int i, j;
+
+  index_natives(pic, &d->natives);
+
+  visit_value(pic, d, obj);
+  for (i = j = 0; i < d->nirep || j < d->nobj;) {
+    if (i < d->nirep) {
+      collect_irep(pic, d, d->ireps[i++]);
+    } else {
+      collect(pic, d, d->objs[j++]);
+    }
+  }
+
+  xfwrite(pic, DUMP_MAGIC, 1, sizeof DUMP_MAGIC - 1, d->file);
+  put_byte(pic, d, DUMP_VERSION);
+  put_uint(pic, d, d->nirep);
+  put_uint(pic, d, d->nobj);
+  for (i = 0; i < d->nirep; ++i) {
+    put_irep_shape(pic, d, d->ireps[i]);
+  }
+  for (i = 0; i < d->nobj; ++i) {
+    put_shape(pic, d, d->objs[i]);
+  }
+  for (i = 0; i < d->nirep; ++i) {
+    put_irep_fill(pic, d, d->ireps[i]);
+  }
+  for (i = 0; i < d->nobj; ++i) {
+    put_fill(pic, d, d->objs[i]);
+  }
+  for (i = 0; i < d->nobj; ++i) {
+    if (pic_table_p(pic, pic_obj_value(d->objs[i]))) {
+      put_table_fill(pic, d, d->objs[i]);
+    }
+  }
+  put_value(pic, d, obj);
+}
+
+static void
+dumper_destroy(pic_state *pic, struct dumper *d)
+{
+  kh_destroy(dump, &d->index);
+  kh_destroy(weak, &d->natives);
+  pic_free(pic, d->ireps);
+  pic_free(pic, d->objs);
+  free_entries(pic, &d->ents);
+}
+
+static void
+dump_image(pic_state *pic, pic_value obj, pic_value owned, xFILE *file)
+{
+  struct dumper d;
+  pic_value e;
+
+  d.file = file;
+  d.owned = owned;
+  kh_init(dump, &d.index);
+  kh_init(weak, &d.natives);
+  d.ireps = NULL;
+  d.objs = NULL;
+  d.nirep = d.nobj = d.irepcapa = d.objcapa = 0;
+  d.ents.e = d.ents.tmp = NULL;
+  d.ents.n = d.ents.capa = 0;
+
+  pic_try {
+    dump(pic, &d, obj);
+  }
+  pic_catch(e) {
+    dumper_destroy(pic, &d);
+    pic_raise(pic, e);
+  }
+  dumper_destroy(pic, &d);
+}
+
+void
+pic_dump(pic_state *pic, pic_value obj, xFILE *file)
+{
+  dump_image(pic, obj, pic_false_value(pic), file);
+}
+
+/* also refuses uninterned symbols that name a global variable or macro
+   not listed in owned (a dictionary), as read back they would name a new one */
+void
+pic_dump_unit(pic_state *pic, pic_value obj, pic_value owned, xFILE *file)
+{
+  dump_image(pic, obj, owned, file);
+}
+
+/* read */
+
+struct loader {
+  const unsigned char *p, *end;
+  struct irep **ireps;
+  size_t (*sizes)[2];           /* nirep and npool of each irep until filled in */
+  int nirep, nobj;
+  pic_value objs;               /* vector */
+  pic_value env;                /* placeholder in incomplete objects */
+};
+
+#define malformed(pic) pic_error(pic, "malformed image", 0)
+
+static int
+get_byte(pic_state *pic, struct loader *l)
+{
+  if (l->p == l->end) {
+    malformed(pic);
+  }
+  return *l->p++;
+}
+
+static uint64_t
+get_uint(pic_state *pic, struct loader *l)
+{
+  uint64_t n = 0;
+  int c, shift = 0;
+
+  do {
+    if (shift > 63) {
+      malformed(pic);
+    }
+    c = get_byte(pic, l);
+    n |= (uint64_t)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return n;
+}
+
+static int64_t
+get_int(pic_state *pic, struct loader *l)
+{
+  uint64_t n = get_uint(pic, l);
+
+  return (n & 1) ? (int64_t)~(n >> 1) : (int64_t)(n >> 1);
+}
+
+static int
+get_count(pic_state *pic, struct loader *l, int max)
+{
+  uint64_t n = get_uint(pic, l);
+
+  if (n > (uint64_t)max) {
+    malformed(pic);
+  }
+  return (int)n;
+}
+
+/* a count of entries that take a byte each at least */
+#define get_length(pic, l) get_count(pic, l, (int)((l)->end - (l)->p))
+
+static int
+get_operand(pic_state *pic, struct loader *l)
+{
+  int64_t n = get_int(pic, l);
+
+  if (n < INT_MIN || INT_MAX < n) {
+    malformed(pic);
+  }
+  return (int)n;
+}
+
+static double
+get_float(pic_state *pic, struct loader *l)
+{
+  uint64_t w = 0;
+  double f;
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    w |= (uint64_t)get_byte(pic, l) << (i * 8);
+  }
+  memcpy(&f, &w, sizeof f);
+  return f;
+}
+
+static const char *
+get_bytes(pic_state *pic, struct loader *l, int *len)
+{
+  const char *buf;
+
+  *len = get_length(pic, l);
+  buf = (const char *)l->p;
+  l->p += *len;
+  return buf;
+}
+
+static pic_value
+get_str(pic_state *pic, struct loader *l)
+{
+  const char *buf;
+  int len;
+
+  buf = get_bytes(pic, l, &len);
+  return pic_str_value(pic, buf, len);
+}
+
+static struct irep *
+get_irep(pic_state *pic, struct loader *l)
+{
+  uint64_t n = get_uint(pic, l);
+
+  if (n >= (uint64_t)l->nirep) {
+    malformed(pic);
+  }
+  return l->ireps[n];
+}
+
+static pic_value
+get_ref(pic_state *pic, struct loader *l)
+{
+  uint64_t n = get_uint(pic, l);
+
+  if (n < (uint64_t)l->nirep || (uint64_t)l->nirep + l->nobj <= n) {
+    malformed(pic);
+  }
+  return pic_vec_ref(pic, l->objs, (int)(n - l->nirep));
+}
+
+static pic_value
+get_typed_ref(pic_state *pic, struct loader *l, int type)
+{
+  pic_value v = get_ref(pic, l);
+
+  if (pic_type(pic, v) != type) {
+    malformed(pic);
+  }
+  return v;
+}
+
+static pic_value
+get_value(pic_state *pic, struct loader *l)
+{
+  int64_t i;
+
+  switch (get_byte(pic, l)) {
+  case V_NIL: return pic_nil_value(pic);
+  case V_TRUE: return pic_true_value(pic);
+  case V_FALSE: return pic_false_value(pic);
+  case V_UNDEF: return pic_undef_value(pic);
+  case V_EOF: return pic_eof_object(pic);
+  case V_INVALID: return pic_invalid_value(pic);
+  case V_INT:
+    i = get_int(pic, l);
+    if ((pic_fixnum_t)i != i) {
+      return pic_big_from_int64(pic, i);
+    }
+    return pic_fixnum_value(pic, (pic_fixnum_t)i);
+  case V_FLOAT: return pic_float_value(pic, get_float(pic, l));
+  case V_CHAR: return pic_char_value(pic, get_count(pic, l, 0x10ffff));
+  case V_REF: return get_ref(pic, l);
+  default:
+    malformed(pic);
+  }
+  PIC_UNREACHABLE();
+}
+
+/* nil stands for NULL */
+static void *
+get_optional(pic_state *pic, struct loader *l, int type)
+{
+  pic_value v = get_value(pic, l);
+
+  if (pic_nil_p(pic, v)) {
+    return NULL;
+  }
+  if (pic_type(pic, v) != type) {
+    malformed(pic);
+  }
+  return pic_obj_ptr(v);
+}
+
+static void
+check_operands(pic_state *pic, struct irep *irep, size_t nirep, size_t npool)
+{
+  size_t i;
+  struct code c;
+
+  for (i = 0; i < irep->ncode; ++i) {
+    c = irep->code[i];
+    switch (c.insn) {
+    case OP_PUSHINT:
+    case OP_PUSHCHAR:
+      if (c.a < 0 || irep->nints <= (size_t)c.a) malformed(pic);
+      break;
+    case OP_PUSHFLOAT:
+      if (c.a < 0 || irep->nnums <= (size_t)c.a) malformed(pic);
+      break;
+    case OP_PUSHCONST:
+    case OP_GREF:
+    case OP_GSET:
+      if (c.a < 0 || npool <= (size_t)c.a) malformed(pic);
+      break;
+    case OP_LAMBDA:
+      if (c.a < 0 || nirep <= (size_t)c.a) malformed(pic);
+      break;
+    case OP_JMP:
+    case OP_JMPIF:
+      if (c.a < -(int)i || (int)(irep->ncode - i) < c.a) malformed(pic);
+      break;
+    }
+  }
+}
+
+static void
+get_irep_shape(pic_state *pic, struct loader *l, int n)
+{
+  struct irep *irep = l->ireps[n];
+  size_t i;
+
+  if (get_byte(pic, l) != O_IREP) {
+    malformed(pic);
+  }
+  irep->argc = get_count(pic, l, INT_MAX);
+  irep->localc = get_count(pic, l, INT_MAX);
+  irep->capturec = get_count(pic, l, INT_MAX);
+  irep->varg = get_byte(pic, l) != 0;
+
+  irep->ncode = get_length(pic, l);
+  irep->code = pic_malloc(pic, sizeof(struct code) * irep->ncode);
+  for (i = 0; i < irep->ncode; ++i) {
+    irep->code[i].insn = get_count(pic, l, OP_STOP);
+    irep->code[i].a = get_operand(pic, l);
+    irep->code[i].b = get_operand(pic, l);
+  }
+  irep->nints = get_length(pic, l);
+  irep->ints = pic_malloc(pic, sizeof(pic_fixnum_t) * irep->nints);
+  for (i = 0; i < irep->nints; ++i) {
+    int64_t k = get_int(pic, l);
+    if ((pic_fixnum_t)k != k) {
+      malformed(pic);
+    }
+    irep->ints[i] = (pic_fixnum_t)k;
+  }
+  irep->nnums = get_length(pic, l);
+  irep->nums = pic_malloc(pic, sizeof(double) * irep->nnums);
+  for (i = 0; i < irep->nnums; ++i) {
+    irep->nums[i] = get_float(pic, l);
+  }
+
+  /* children and pool stay empty to the GC until they are filled in */
+  l->sizes[n][0] = get_length(pic, l);
+  l->sizes[n][1] = get_length(pic, l);
+  irep->irep = pic_malloc(pic, sizeof(struct irep *) * l->sizes[n][0]);
+  irep->pool = pic_malloc(pic, sizeof(struct object *) * l->sizes[n][1]);
+
+  check_operands(pic, irep, l->sizes[n][0], l->sizes[n][1]);
+}
+
+static pic_value
+get_shape(pic_state *pic, struct loader *l)
+{
+  pic_value v, name;
+  const char *buf;
+  int len, it;
+
+  switch (get_byte(pic, l)) {
+  case O_SYMBOL:
+    buf = get_bytes(pic, l, &len);
+    return pic_intern_str(pic, buf, len);
+  case O_USYMBOL:
+    return pic_make_symbol(pic, get_str(pic, l));
+  case O_STRING:
+    return get_str(pic, l);
+  case O_BLOB:
+    buf = get_bytes(pic, l, &len);
+    return pic_blob_value(pic, (const unsigned char *)buf, len);
+  case O_BIGNUM:
+    v = pic_big_from_string(pic, pic_str(pic, get_str(pic, l)), 16);
+    if (! pic_bignum_p(pic, v)) {
+      malformed(pic);
+    }
+    return v;
+  case O_PAIR:
+    return pic_cons(pic, pic_undef_value(pic), pic_undef_value(pic));
+  case O_VECTOR:
+    return pic_make_vec(pic, get_length(pic, l), NULL);
+  case O_ID:
+    return pic_make_identifier(pic, pic_obj_value(pic->sDEFINE), l->env);
+  case O_LIBENV:
+    name = get_str(pic, l);
+    it = kh_get(ltable, &pic->ltable, pic_str(pic, name));
+    if (it == kh_end(&pic->ltable)) {
+      pic_error(pic, "image refers to unknown library", 1, name);
+    }
+    return pic_obj_value(kh_val(&pic->ltable, it).env);
+  case O_ENV:
+    v = pic_make_env(pic, l->env);
+    pic_env_ptr(pic, v)->up = NULL;
+    return v;
+  case O_DICT:
+    return pic_make_dict(pic);
+  case O_RECORD:
+    return pic_make_rec(pic, pic_undef_value(pic), pic_undef_value(pic));
+  case O_TABLE:
+    return pic_make_table(pic, get_count(pic, l, PIC_TABLE_STRING), false);
+  case O_PROC:
+    return pic_make_proc_irep(pic, get_irep(pic, l), NULL);
+  case O_CXT: {
+    struct context *cxt;
+    len = get_length(pic, l);
+    cxt = (struct context *)pic_obj_alloc(pic, offsetof(struct context, storage) + sizeof(pic_value) * len, PIC_TYPE_CXT);
+    cxt->regs = cxt->storage;
+    cxt->regc = len;
+    cxt->up = NULL;
+    for (it = 0; it < len; ++it) {
+      cxt->storage[it] = pic_undef_value(pic);
+    }
+    return pic_obj_value(cxt);
+  }
+  case O_NATIVE:
+    name = get_str(pic, l);
+    v = pic_intern(pic, name);
+    if (! pic_global_p(pic, v) || ! pic_func_p(pic, pic_global_ref(pic, v))) {
+      pic_error(pic, "image refers to unknown procedure", 1, name);
+    }
+    return pic_global_ref(pic, v);
+  default:
+    malformed(pic);
+  }
+  PIC_UNREACHABLE();
+}
+
+static void
+get_irep_fill(pic_state *pic, struct loader *l, int n)
+{
+  struct irep *irep = l->ireps[n];
+
+  while (irep->nirep < l->sizes[n][0]) {
+    irep->irep[irep->nirep] = get_irep(pic, l);
+    pic_irep_incref(pic, irep->irep[irep->nirep++]);
+  }
+  while (irep->npool < l->sizes[n][1]) {
+    irep->pool[irep->npool++] = pic_obj_ptr(get_ref(pic, l));
+  }
+}
+
+static void
+get_fill(pic_state *pic, struct loader *l, pic_value v)
+{
+  pic_value key, val;
+  int i, n, it, ret;
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_PAIR:
+    pic_set_car(pic, v, get_value(pic, l));
+    pic_set_cdr(pic, v, get_value(pic, l));
+    break;
+  case PIC_TYPE_VECTOR:
+    for (i = 0; i < pic_vec_len(pic, v); ++i) {
+      pic_vec_set(pic, v, i, get_value(pic, l));
+    }
+    break;
+  case PIC_TYPE_ID:
+    key = get_ref(pic, l);
+    val = get_typed_ref(pic, l, PIC_TYPE_ENV);
+    if (! pic_id_p(pic, key)) {
+      malformed(pic);
+    }
+    pic_id_ptr(pic, v)->u.id = pic_id_ptr(pic, key);
+    pic_id_ptr(pic, v)->env = pic_env_ptr(pic, val);
+    break;
+  case PIC_TYPE_ENV: {
+    struct env *env = pic_env_ptr(pic, v);
+    if (libenv_p(env)) {
+      break;
+    }
+    env->up = get_optional(pic, l, PIC_TYPE_ENV);
+    n = get_length(pic, l);
+    for (i = 0; i < n; ++i) {
+      key = get_ref(pic, l);
+      val = get_typed_ref(pic, l, PIC_TYPE_SYMBOL);
+      if (! pic_id_p(pic, key)) {
+        malformed(pic);
+      }
+      it = kh_put(env, &env->map, pic_id_ptr(pic, key), &ret);
+      kh_val(&env->map, it) = pic_sym_ptr(pic, val);
+    }
+    break;
+  }
+  case PIC_TYPE_DICT:
+    n = get_length(pic, l);
+    for (i = 0; i < n; ++i) {
+      key = get_value(pic, l);
+      val = get_value(pic, l);
+      if (! pic_sym_p(pic, key)) {
+        malformed(pic);
+      }
+      pic_dict_set(pic, v, key, val);
+    }
+    break;
+  case PIC_TYPE_RECORD:
+    pic_rec_ptr(pic, v)->type = get_value(pic, l);
+    pic_rec_ptr(pic, v)->datum = get_value(pic, l);
+    break;
+  case PIC_TYPE_IREP:
+    pic_proc_ptr(pic, v)->u.i.cxt = get_optional(pic, l, PIC_TYPE_CXT);
+    break;
+  case PIC_TYPE_CXT: {
+    struct context *cxt = (struct context *)pic_obj_ptr(v);
+    cxt->up = get_optional(pic, l, PIC_TYPE_CXT);
+    for (i = 0; i < cxt->regc; ++i) {
+      cxt->regs[i] = get_value(pic, l);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+static void
+get_table_fill(pic_state *pic, struct loader *l, pic_value table)
+{
+  pic_value key, val;
+  int i, n;
+
+  n = get_length(pic, l);
+  for (i = 0; i < n; ++i) {
+    key = get_value(pic, l);
+    val = get_value(pic, l);
+    if (pic_table_ptr(pic, table)->kind == PIC_TABLE_STRING && ! pic_str_p(pic, key)) {
+      malformed(pic);
+    }
+    pic_table_set(pic, table, key, val);
+  }
+}
+
+static pic_value
+undump(pic_state *pic, struct loader *l)
+{
+  size_t ai = pic_enter(pic);
+  int i;
+
+  for (i = 0; i < l->nirep; ++i) {
+    get_irep_shape(pic, l, i);
+  }
+  /* all shells are valid objects on their own, so the GC may run at will */
+  for (i = 0; i < l->nobj; ++i) {
+    pic_vec_set(pic, l->objs, i, get_shape(pic, l));
+    pic_leave(pic, ai);
+  }
+  for (i = 0; i < l->nirep; ++i) {
+    get_irep_fill(pic, l, i);
+  }
+  for (i = 0; i < l->nobj; ++i) {
+    get_fill(pic, l, pic_vec_ref(pic, l->objs, i));
+    pic_leave(pic, ai);
+  }
+  for (i = 0; i < l->nobj; ++i) {
+    if (pic_table_p(pic, pic_vec_ref(pic, l->objs, i))) {
+      get_table_fill(pic, l, pic_vec_ref(pic, l->objs, i));
+      pic_leave(pic, ai);
+    }
+  }
+  return get_value(pic, l);
+}
+
+pic_value
+pic_undump(pic_state *pic, const unsigned char *buf, size_t len)
+{
+  struct loader l;
+  size_t ai;
+  pic_value v, e;
+  int i;
+
+  l.p = buf;
+  l.end = buf + len;
+
+  if (len < sizeof DUMP_MAGIC || memcmp(buf, DUMP_MAGIC, sizeof DUMP_MAGIC - 1) != 0) {
+    malformed(pic);
+  }
+  l.p += sizeof DUMP_MAGIC - 1;
+  if (get_byte(pic, &l) != DUMP_VERSION) {
+    pic_error(pic, "image was written by another version", 0);
+  }
+  l.nirep = get_length(pic, &l);
+  l.nobj = get_length(pic, &l);
+
+  ai = pic_enter(pic);
+  l.objs = pic_make_vec(pic, l.nobj, NULL);
+  l.env = pic_library_environment(pic, pic_current_library(pic));
+
+  /* each irep is held by the loader until the closures take it over */
+  l.ireps = pic_malloc(pic, sizeof(struct irep *) * l.nirep);
+  l.sizes = pic_malloc(pic, sizeof *l.sizes * l.nirep);
+  for (i = 0; i < l.nirep; ++i) {
+    struct irep *irep = pic_calloc(pic, 1, sizeof(struct irep));
+    irep->refc = 1;
+    irep->list.next = pic->ireps.next;
+    irep->list.prev = &pic->ireps;
+    irep->list.next->prev = &irep->list;
+    irep->list.prev->next = &irep->list;
+    l.ireps[i] = irep;
+  }
+
+  pic_try {
+    v = undump(pic, &l);
+  }
+  pic_catch(e) {
+    for (i = 0; i < l.nirep; ++i) {
+      pic_irep_decref(pic, l.ireps[i]);
+    }
+    pic_free(pic, l.ireps);
+    pic_free(pic, l.sizes);
+    pic_raise(pic, e);
+  }
+  for (i = 0; i < l.nirep; ++i) {
+    pic_irep_decref(pic, l.ireps[i]);
+  }
+  pic_free(pic, l.ireps);
+  pic_free(pic, l.sizes);
+
+  pic_leave(pic, ai);
+  return pic_protect(pic, v);
+}
+
+/* snapshots
+
+   A snapshot is an image of #(libraries globals macros), where each library
+   is #(name environment exports) with the environment as an association
+   list. Globals bound to procedures defined in C under their own name are
+   left out, as the state a snapshot is restored into defines them itself.
+   The boot library is loaded from the snapshot of a fresh state. */
+
+static pic_value
+sorted_alist(pic_state *pic, struct entries *es)
+{
+  pic_value alist = pic_nil_value(pic);
+  int i;
+
+  sort_entries(es->e, es->tmp, es->n);
+  for (i = es->n; i-- > 0;) {
+    alist = pic_cons(pic, pic_cons(pic, es->e[i].key, es->e[i].val), alist);
+  }
+  return alist;
+}
+
+static pic_value
+weak_alist(pic_state *pic, pic_value weak, khash_t(weak) *natives, struct entries *es)
+{
+  khash_t(weak) *h = &pic_weak_ptr(pic, weak)->hash;
+  pic_value key, val;
+  int it;
+
+  es->n = 0;
+  for (it = kh_begin(h); it != kh_end(h); ++it) {
+    if (! kh_exist(h, it)) {
+      continue;
+    }
+    key = pic_obj_value(kh_key(h, it));
+    val = kh_val(h, it);
+    if (natives && pic_func_p(pic, val)) {
+      int k = kh_get(weak, natives, pic_obj_ptr(val));
+      if (k != kh_end(natives) && pic_eq_p(pic, kh_val(natives, k), key)) {
+        continue;
+      }
+    }
+    add_entry(pic, es, pic_sym(pic, key), "", key, val);
+  }
+  return sorted_alist(pic, es);
+}
+
+/* everything is written in name order, so that regenerating an image from
+   the same sources gives the same bytes */
+void
+pic_snapshot(pic_state *pic, xFILE *file)
+{
+  khash_t(ltable) *h = &pic->ltable;
+  khash_t(weak) natives;
+  struct entries libs, ents;
+  struct lib *lib;
+  pic_value ent[3], root[3];
+  size_t ai = pic_enter(pic);
+  int it, i;
+
+  libs.e = libs.tmp = ents.e = ents.tmp = NULL;
+  libs.n = libs.capa = ents.n = ents.capa = 0;
+
+  for (it = kh_begin(h); it != kh_end(h); ++it) {
+    if (! kh_exist(h, it)) {
+      continue;
+    }
+    lib = &kh_val(h, it);
+    env_entries(pic, &ents, lib->env);
+    ent[0] = pic_obj_value(lib->name);
+    ent[1] = sorted_alist(pic, &ents);
+    ent[2] = pic_obj_value(lib->exports);
+    add_entry(pic, &libs, kh_key(h, it), "", pic_make_vec(pic, 3, ent), pic_nil_value(pic));
+  }
+  sort_entries(libs.e, libs.tmp, libs.n);
+  root[0] = pic_nil_value(pic);
+  for (i = libs.n; i-- > 0;) {
+    root[0] = pic_cons(pic, libs.e[i].key, root[0]);
+  }
+
+  kh_init(weak, &natives);
+  index_natives(pic, &natives);
+  root[1] = weak_alist(pic, pic->globals, &natives, &ents);
+  kh_destroy(weak, &natives);
+
+  root[2] = weak_alist(pic, pic->macros, NULL, &ents);
+
+  free_entries(pic, &libs);
+  free_entries(pic, &ents);
+
+  pic_dump(pic, pic_make_vec(pic, 3, root), file);
+  pic_leave(pic, ai);
+}
+
+/* an association list of symbols, or identifiers if ids is set, to values of the given type, or any if type is -1 */
+static bool
+alist_p(pic_state *pic, pic_value alist, bool ids, int type)
+{
+  pic_value ent, it;
+
+  if (! pic_list_p(pic, alist)) {
+    return false;
+  }
+  pic_for_each (ent, alist, it) {
+    if (! pic_pair_p(pic, ent) || ! (ids ? pic_id_p(pic, pic_car(pic, ent)) : pic_sym_p(pic, pic_car(pic, ent)))) {
+      return false;
+    }
+    if (type != -1 && pic_type(pic, pic_cdr(pic, ent)) != type) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* a dictionary from symbols to identifiers */
+static bool
+exports_p(pic_state *pic, pic_value dict)
+{
+  pic_value key, val;
+  int i = 0;
+
+  if (! pic_dict_p(pic, dict)) {
+    return false;
+  }
+  while (pic_dict_next(pic, dict, &i, &key, &val)) {
+    if (! pic_sym_p(pic, key) || ! pic_id_p(pic, val)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool
+snapshot_p(pic_state *pic, pic_value root)
+{
+  pic_value lib, ent, it, it2;
+
+  if (! pic_vec_p(pic, root) || pic_vec_len(pic, root) != 3 || ! pic_list_p(pic, pic_vec_ref(pic, root, 0))) {
+    return false;
+  }
+  pic_for_each (lib, pic_vec_ref(pic, root, 0), it) {
+    if (! pic_vec_p(pic, lib) || pic_vec_len(pic, lib) != 3
+        || ! pic_str_p(pic, pic_vec_ref(pic, lib, 0))
+        || ! alist_p(pic, pic_vec_ref(pic, lib, 1), true, PIC_TYPE_SYMBOL)
+        || ! exports_p(pic, pic_vec_ref(pic, lib, 2))) {
+      return false;
+    }
+  }
+  if (! alist_p(pic, pic_vec_ref(pic, root, 1), false, -1) || ! alist_p(pic, pic_vec_ref(pic, root, 2), false, -1)) {
+    return false;
+  }
+  pic_for_each (ent, pic_vec_ref(pic, root, 2), it2) {
+    if (! pic_proc_p(pic, pic_cdr(pic, ent))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void
+restore(pic_state *pic, pic_value root)
+{
+  pic_value lib, ent, it, it2, env, exports, key, val, uid;
+  const char *name;
+  int i;
+
+  pic_for_each (ent, pic_vec_ref(pic, root, 1), it) {
+    pic_weak_set(pic, pic->globals, pic_car(pic, ent), pic_cdr(pic, ent));
+  }
+  pic_for_each (ent, pic_vec_ref(pic, root, 2), it) {
+    pic_weak_set(pic, pic->macros, pic_car(pic, ent), pic_cdr(pic, ent));
+  }
+  pic_for_each (lib, pic_vec_ref(pic, root, 0), it) {
+    name = pic_str(pic, pic_vec_ref(pic, lib, 0));
+    if (! pic_find_library(pic, name)) {
+      pic_make_library(pic, name);
+    }
+    env = pic_library_environment(pic, name);
+    pic_for_each (ent, pic_vec_ref(pic, lib, 1), it2) {
+      pic_put_identifier(pic, pic_car(pic, ent), pic_cdr(pic, ent), env);
+    }
+    exports = pic_obj_value(kh_val(&pic->ltable, kh_get(ltable, &pic->ltable, name)).exports);
+    i = 0;
+    while (pic_dict_next(pic, pic_vec_ref(pic, lib, 2), &i, &key, &val)) {
+      /* built-ins configured out of this build are not exported */
+      uid = pic_find_identifier(pic, val, env);
+      if (pic_global_p(pic, uid) || pic_weak_has(pic, pic->macros, uid)) {
+        pic_dict_set(pic, exports, key, val);
+      }
+    }
+  }
+}
+
+/* false if the snapshot cannot be restored; the state is left as it was then */
+bool
+pic_restore(pic_state *pic, const unsigned char *buf, size_t len)
+{
+  size_t ai = pic_enter(pic);
+  pic_value root, e;
+
+  pic_try {
+    root = pic_undump(pic, buf, len);
+  }
+  pic_catch(e) {
+    (void)e;
+    pic_leave(pic, ai);
+    return false;
+  }
+  if (! snapshot_p(pic, root)) {
+    pic_leave(pic, ai);
+    return false;
+  }
+  restore(pic, root);
+  pic_leave(pic, ai);
+  return true;
+}
@@ -8,10 +8,9 @@
 #include "picrin/private/vm.h"
 #include "picrin/private/state.h"
 
-static pic_value pic_compile(pic_state *, pic_value);
-
-#define EQ(sym, lit) (strcmp(pic_sym(pic, sym), lit) == 0)
-#define S(lit) (pic_intern_lit(pic, lit))
+/* keywords are interned once per state (see pic_open), so they compare by identity */
+#define EQ(sym, kw) (pic_sym_p(pic, sym) && pic_sym_ptr(pic, sym) == pic->kw)
+#define S(kw) (pic_obj_value(pic->kw))
 
 static void
 define_macro(pic_state *pic, pic_value uid, pic_value mac)
@@ -20,6 +19,7 @@ define_macro(pic_state *pic, pic_value uid, pic_value mac)
     pic_warnf(pic, "redefining syntax variable: %s", pic_sym(pic, uid));
   }
   pic_weak_set(pic, pic->macros, uid, mac);
+  pic_journal(pic, PIC_JOURNAL_MACRO, uid, mac, pic_false_value(pic));
 }
 
 static bool
@@ -37,6 +37,7 @@ shadow_macro(pic_state *pic, pic_value uid)
 {
   if (pic_weak_has(pic, pic->macros, uid)) {
     pic_weak_del(pic, pic->macros, uid);
+    pic_journal(pic, PIC_JOURNAL_SHADOW, uid, pic_false_value(pic), pic_false_value(pic));
   }
 }
 
@@ -59,7 +60,7 @@ expand_var(pic_state *pic, pic_value id, pic_value env, pic_value deferred)
 static pic_value
 expand_quote(pic_state *pic, pic_value expr)
 {
-  return pic_cons(pic, S("quote"), pic_cdr(pic, expr));
+  return pic_cons(pic, S(sQUOTE), pic_cdr(pic, expr));
 }
 
 static pic_value
@@ -133,7 +134,7 @@ expand_lambda(pic_state *pic, pic_value expr, pic_value env)
 
   expand_deferred(pic, deferred, in);
 
-  return pic_list(pic, 3, S("lambda"), formal, body);
+  return pic_list(pic, 3, S(sLAMBDA), formal, body);
 }
 
 static pic_value
@@ -147,7 +148,7 @@ expand_define(pic_state *pic, pic_value expr, pic_value env, pic_value deferred)
 
   val = expand(pic, pic_list_ref(pic, expr, 2), env, deferred);
 
-  return pic_list(pic, 3, S("define"), uid, val);
+  return pic_list(pic, 3, S(sDEFINE), uid, val);
 }
 
 static pic_value
@@ -187,16 +188,16 @@ expand_node(pic_state *pic, pic_value expr, pic_value env, pic_value deferred)
 
       functor = pic_find_identifier(pic, pic_car(pic, expr), env);
 
-      if (EQ(functor, "define-macro")) {
+      if (EQ(functor, sDEFINE_MACRO)) {
         return expand_defmacro(pic, expr, env);
       }
-      else if (EQ(functor, "lambda")) {
+      else if (EQ(functor, sLAMBDA)) {
         return expand_defer(pic, expr, deferred);
       }
-      else if (EQ(functor, "define")) {
+      else if (EQ(functor, sDEFINE)) {
         return expand_define(pic, expr, env, deferred);
       }
-      else if (EQ(functor, "quote")) {
+      else if (EQ(functor, sQUOTE)) {
         return expand_quote(pic, expr);
       }
 
@@ -253,10 +254,10 @@ optimize_beta(pic_state *pic, pic_value expr)
   if (pic_sym_p(pic, pic_list_ref(pic, expr, 0))) {
     pic_value sym = pic_list_ref(pic, expr, 0);
 
-    if (EQ(sym, "quote")) {
+    if (EQ(sym, sQUOTE)) {
       return expr;
-    } else if (EQ(sym, "lambda")) {
-      return pic_list(pic, 3, S("lambda"), pic_list_ref(pic, expr, 1), optimize_beta(pic, pic_list_ref(pic, expr, 2)));
+    } else if (EQ(sym, sLAMBDA)) {
+      return pic_list(pic, 3, S(sLAMBDA), pic_list_ref(pic, expr, 1), optimize_beta(pic, pic_list_ref(pic, expr, 2)));
     }
   }
 
@@ -270,7 +271,7 @@ optimize_beta(pic_state *pic, pic_value expr)
   pic_protect(pic, expr);
 
   functor = pic_list_ref(pic, expr, 0);
-  if (pic_pair_p(pic, functor) && EQ(pic_car(pic, functor), "lambda")) {
+  if (pic_pair_p(pic, functor) && EQ(pic_car(pic, functor), sLAMBDA)) {
     formals = pic_list_ref(pic, functor, 1);
     if (! pic_list_p(pic, formals))
       goto exit;              /* TODO: support ((lambda args x) 1 2) */
@@ -279,12 +280,12 @@ optimize_beta(pic_state *pic, pic_value expr)
       goto exit;
     defs = pic_nil_value(pic);
     pic_for_each (val, args, it) {
-      pic_push(pic, pic_list(pic, 3, S("define"), pic_car(pic, formals), val), defs);
+      pic_push(pic, pic_list(pic, 3, S(sDEFINE), pic_car(pic, formals), val), defs);
       formals = pic_cdr(pic, formals);
     }
     expr = pic_list_ref(pic, functor, 2);
     pic_for_each (val, defs, it) {
-      expr = pic_list(pic, 3, S("begin"), val, expr);
+      expr = pic_list(pic, 3, S(sBEGIN), val, expr);
     }
   }
  exit:
@@ -304,6 +305,7 @@ typedef struct analyze_scope {
   int depth;
   pic_value rest;                   /* Nullable */
   pic_value args, locals, captures; /* rest args variable is counted as a local */
+                                    /* locals and captures map to their order of appearance */
   pic_value defer;
   struct analyze_scope *up;
 } analyze_scope;
@@ -324,7 +326,7 @@ analyzer_scope_init(pic_state *pic, analyze_scope *scope, pic_value formal, anal
   }
   else {
     scope->rest = formal;
-    pic_dict_set(pic, scope->locals, formal, pic_true_value(pic));
+    pic_dict_set(pic, scope->locals, formal, pic_int_value(pic, 0));
   }
 
   scope->up = up;
@@ -351,8 +353,8 @@ find_var(pic_state *pic, analyze_scope *scope, pic_value sym)
 
   while (scope) {
     if (find_local_var(pic, scope, sym)) {
-      if (depth > 0) {
-        pic_dict_set(pic, scope->captures, sym, pic_true_value(pic)); /* capture! */
+      if (depth > 0 && ! pic_dict_has(pic, scope->captures, sym)) {
+        pic_dict_set(pic, scope->captures, sym, pic_int_value(pic, pic_dict_size(pic, scope->captures))); /* capture! */
       }
       return depth;
     }
@@ -371,14 +373,15 @@ define_var(pic_state *pic, analyze_scope *scope, pic_value sym)
       pic_warnf(pic, "redefining variable: %s", pic_sym(pic, sym));
       return;
     }
-    pic_dict_set(pic, scope->locals, sym, pic_true_value(pic));
+    pic_dict_set(pic, scope->locals, sym, pic_int_value(pic, pic_dict_size(pic, scope->locals)));
   } else {
     /* global */
-    if (pic_weak_has(pic, pic->globals, sym)) {
+    if (pic_global_p(pic, sym)) {
       pic_warnf(pic, "redefining variable: %s", pic_sym(pic, sym));
       return;
     }
     pic_weak_set(pic, pic->globals, sym, pic_invalid_value(pic));
+    pic_journal(pic, PIC_JOURNAL_GLOBAL, sym, pic_false_value(pic), pic_false_value(pic));
   }
 }
 
@@ -393,11 +396,11 @@ analyze_var(pic_state *pic, analyze_scope *scope, pic_value sym)
   depth = find_var(pic, scope, sym);
 
   if (depth == scope->depth) {
-    return pic_list(pic, 2, S("gref"), sym);
+    return pic_list(pic, 2, S(sGREF), sym);
   } else if (depth == 0) {
-    return pic_list(pic, 2, S("lref"), sym);
+    return pic_list(pic, 2, S(sLREF), sym);
   } else {
-    return pic_list(pic, 3, S("cref"), pic_int_value(pic, depth), sym);
+    return pic_list(pic, 3, S(sCREF), pic_int_value(pic, depth), sym);
   }
 }
 
@@ -436,8 +439,8 @@ analyze_lambda(pic_state *pic, analyze_scope *up, pic_value form)
   analyze_scope s, *scope = &s;
   pic_value formals, body;
   pic_value rest;
-  pic_value args, locals, captures, key;
-  int i, j, it;
+  pic_value args, locals, captures, key, val;
+  int i, it;
 
   formals = pic_list_ref(pic, form, 1);
   body = pic_list_ref(pic, form, 2);
@@ -455,28 +458,23 @@ analyze_lambda(pic_state *pic, analyze_scope *up, pic_value form)
 
   rest = scope->rest;
 
+  /* in order of appearance, rest args first, so that the code does not
+     depend on heap addresses */
   locals = pic_make_vec(pic, pic_dict_size(pic, scope->locals), NULL);
-  j = 0;
-  if (pic_sym_p(pic, scope->rest)) {
-    pic_vec_set(pic, locals, j++, scope->rest);
-  }
   it = 0;
-  while (pic_dict_next(pic, scope->locals, &it, &key, NULL)) {
-    if (pic_eq_p(pic, key, rest))
-      continue;
-    pic_vec_set(pic, locals, j++, key);
+  while (pic_dict_next(pic, scope->locals, &it, &key, &val)) {
+    pic_vec_set(pic, locals, pic_int(pic, val), key);
   }
 
   captures = pic_make_vec(pic, pic_dict_size(pic, scope->captures), NULL);
   it = 0;
-  j = 0;
-  while (pic_dict_next(pic, scope->captures, &it, &key, NULL)) {
-    pic_vec_set(pic, captures, j++, key);
+  while (pic_dict_next(pic, scope->captures, &it, &key, &val)) {
+    pic_vec_set(pic, captures, pic_int(pic, val), key);
   }
 
   analyzer_scope_destroy(pic, scope);
 
-  return pic_list(pic, 6, S("lambda"), rest, args, locals, captures, body);
+  return pic_list(pic, 6, S(sLAMBDA), rest, args, locals, captures, body);
 }
 
 static pic_value
@@ -502,7 +500,7 @@ analyze_define(pic_state *pic, analyze_scope *scope, pic_value obj)
 static pic_value
 analyze_call(pic_state *pic, analyze_scope *scope, pic_value obj)
 {
-  return pic_cons(pic, S("call"), analyze_list(pic, scope, obj));
+  return pic_cons(pic, S(sCALL), analyze_list(pic, scope, obj));
 }
 
 static pic_value
@@ -523,16 +521,16 @@ analyze_node(pic_state *pic, analyze_scope *scope, pic_value obj)
     if (pic_sym_p(pic, proc)) {
       pic_value sym = proc;
 
-      if (EQ(sym, "define")) {
+      if (EQ(sym, sDEFINE)) {
         return analyze_define(pic, scope, obj);
       }
-      else if (EQ(sym, "lambda")) {
+      else if (EQ(sym, sLAMBDA)) {
         return analyze_defer(pic, scope, obj);
       }
-      else if (EQ(sym, "quote")) {
+      else if (EQ(sym, sQUOTE)) {
         return obj;
       }
-      else if (EQ(sym, "begin") || EQ(sym, "set!") || EQ(sym, "if")) {
+      else if (EQ(sym, sBEGIN) || EQ(sym, sSETBANG) || EQ(sym, sIF)) {
         return pic_cons(pic, pic_car(pic, obj), analyze_list(pic, scope, pic_cdr(pic, obj)));
       }
     }
@@ -540,7 +538,7 @@ analyze_node(pic_state *pic, analyze_scope *scope, pic_value obj)
     return analyze_call(pic, scope, obj);
   }
   default:
-    return pic_list(pic, 2, S("quote"), obj);
+    return pic_list(pic, 2, S(sQUOTE), obj);
   }
 }
 
@@ -583,7 +581,7 @@ typedef struct codegen_context {
   struct irep **irep;
   size_t ilen, icapa;
   /* constant object pool */
-  int *ints;
+  pic_fixnum_t *ints;
   size_t klen, kcapa;
   double *nums;
   size_t flen, fcapa;
@@ -617,7 +615,7 @@ codegen_context_init(pic_state *pic, codegen_context *cxt, codegen_context *up,
   cxt->plen = 0;
   cxt->pcapa = PIC_POOL_SIZE;
 
-  cxt->ints = pic_calloc(pic, PIC_POOL_SIZE, sizeof(int));
+  cxt->ints = pic_calloc(pic, PIC_POOL_SIZE, sizeof(pic_fixnum_t));
   cxt->klen = 0;
   cxt->kcapa = PIC_POOL_SIZE;
 
@@ -642,7 +640,7 @@ codegen_context_destroy(pic_state *pic, codegen_context *cxt)
   irep->capturec = pic_vec_len(pic, cxt->captures);
   irep->code = pic_realloc(pic, cxt->code, sizeof(struct code) * cxt->clen);
   irep->irep = pic_realloc(pic, cxt->irep, sizeof(struct irep *) * cxt->ilen);
-  irep->ints = pic_realloc(pic, cxt->ints, sizeof(int) * cxt->klen);
+  irep->ints = pic_realloc(pic, cxt->ints, sizeof(pic_fixnum_t) * cxt->klen);
   irep->nums = pic_realloc(pic, cxt->nums, sizeof(double) * cxt->flen);
   irep->pool = pic_realloc(pic, cxt->pool, sizeof(struct object *) * cxt->plen);
   irep->ncode = cxt->clen;
@@ -669,7 +667,7 @@ codegen_context_destroy(pic_state *pic, codegen_context *cxt)
 #define check_code_size(pic, cxt) check_size(pic, cxt, c, code, struct code)
 #define check_irep_size(pic, cxt) check_size(pic, cxt, i, irep, struct irep *)
 #define check_pool_size(pic, cxt) check_size(pic, cxt, p, pool, struct object *)
-#define check_ints_size(pic, cxt) check_size(pic, cxt, k, ints, int)
+#define check_ints_size(pic, cxt) check_size(pic, cxt, k, ints, pic_fixnum_t)
 #define check_nums_size(pic, cxt) check_size(pic, cxt, f, nums, double)
 
 #define emit_n(pic, cxt, ins) do {              \
@@ -791,14 +789,14 @@ codegen_ref(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
   pic_value sym;
 
   sym = pic_car(pic, obj);
-  if (EQ(sym, "gref")) {
+  if (EQ(sym, sGREF)) {
     pic_value name;
 
     name = pic_list_ref(pic, obj, 1);
     emit_i(pic, cxt, OP_GREF, index_global(pic, cxt, name));
     emit_ret(pic, cxt, tailpos);
   }
-  else if (EQ(sym, "cref")) {
+  else if (EQ(sym, sCREF)) {
     pic_value name;
     int depth;
 
@@ -807,7 +805,7 @@ codegen_ref(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
     emit_r(pic, cxt, OP_CREF, depth, index_capture(pic, cxt, name, depth));
     emit_ret(pic, cxt, tailpos);
   }
-  else if (EQ(sym, "lref")) {
+  else if (EQ(sym, sLREF)) {
     pic_value name;
     int i;
 
@@ -833,21 +831,19 @@ codegen_set(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
 
   var = pic_list_ref(pic, obj, 1);
   type = pic_list_ref(pic, var, 0);
-  if (EQ(type, "gref")) {
+  if (EQ(type, sGREF)) {
     pic_value name;
-    size_t i;
 
     name = pic_list_ref(pic, var, 1);
 
-    for (i = 0; i < sizeof pic_vm_proc / sizeof pic_vm_proc[0]; ++i) {
-      if (EQ(name, pic_vm_proc[i].name))
-        pic_error(pic, "tried to override built-in procedure", 1, name);
+    if (pic_dict_has(pic, pic->vmprocs, name)) {
+      pic_error(pic, "tried to override built-in procedure", 1, name);
     }
 
     emit_i(pic, cxt, OP_GSET, index_global(pic, cxt, name));
     emit_ret(pic, cxt, tailpos);
   }
-  else if (EQ(type, "cref")) {
+  else if (EQ(type, sCREF)) {
     pic_value name;
     int depth;
 
@@ -856,7 +852,7 @@ codegen_set(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
     emit_r(pic, cxt, OP_CSET, depth, index_capture(pic, cxt, name, depth));
     emit_ret(pic, cxt, tailpos);
   }
-  else if (EQ(type, "lref")) {
+  else if (EQ(type, sLREF)) {
     pic_value name;
     int i;
 
@@ -949,7 +945,7 @@ codegen_quote(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
   case PIC_TYPE_INT:
     check_ints_size(pic, cxt);
     pidx = (int)cxt->klen++;
-    cxt->ints[pidx] = pic_int(pic, obj);
+    cxt->ints[pidx] = pic_fixnum(pic, obj);
     emit_i(pic, cxt, OP_PUSHINT, pidx);
     break;
   case PIC_TYPE_FLOAT:
@@ -988,14 +984,15 @@ codegen_call(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
   pic_value elt, it, functor;
 
   functor = pic_list_ref(pic, obj, 1);
-  if (EQ(pic_list_ref(pic, functor, 0), "gref")) {
+  if (EQ(pic_list_ref(pic, functor, 0), sGREF)) {
     pic_value sym;
-    size_t i;
+    int i;
 
     sym = pic_list_ref(pic, functor, 1);
 
-    for (i = 0; i < sizeof pic_vm_proc / sizeof pic_vm_proc[0]; ++i) {
-      if (EQ(sym, pic_vm_proc[i].name) && len == pic_vm_proc[i].argc + 2) {
+    if (pic_dict_has(pic, pic->vmprocs, sym)) {
+      i = pic_int(pic, pic_dict_ref(pic, pic->vmprocs, sym));
+      if (len == pic_vm_proc[i].argc + 2) {
         pic_for_each (elt, pic_cddr(pic, obj), it) {
           codegen(pic, cxt, elt, false);
         }
@@ -1018,25 +1015,25 @@ codegen(pic_state *pic, codegen_context *cxt, pic_value obj, bool tailpos)
   pic_value sym;
 
   sym = pic_car(pic, obj);
-  if (EQ(sym, "gref") || EQ(sym, "cref") || EQ(sym, "lref")) {
+  if (EQ(sym, sGREF) || EQ(sym, sCREF) || EQ(sym, sLREF)) {
     codegen_ref(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "set!") || EQ(sym, "define")) {
+  else if (EQ(sym, sSETBANG) || EQ(sym, sDEFINE)) {
     codegen_set(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "lambda")) {
+  else if (EQ(sym, sLAMBDA)) {
     codegen_lambda(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "if")) {
+  else if (EQ(sym, sIF)) {
     codegen_if(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "begin")) {
+  else if (EQ(sym, sBEGIN)) {
     codegen_begin(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "quote")) {
+  else if (EQ(sym, sQUOTE)) {
     codegen_quote(pic, cxt, obj, tailpos);
   }
-  else if (EQ(sym, "call")) {
+  else if (EQ(sym, sCALL)) {
     codegen_call(pic, cxt, obj, tailpos);
   }
   else {
@@ -1059,7 +1056,7 @@ pic_codegen(pic_state *pic, pic_value obj)
 
 #define SAVE(pic, ai, obj) pic_leave(pic, ai); pic_protect(pic, obj)
 
-static pic_value
+pic_value
 pic_compile(pic_state *pic, pic_value obj)
 {
   struct irep *irep;
@@ -1131,5 +1128,12 @@ pic_eval_eval(pic_state *pic)
 void
 pic_init_eval(pic_state *pic)
 {
+  size_t i;
+
+  pic->vmprocs = pic_make_dict(pic);
+  for (i = 0; i < sizeof pic_vm_proc / sizeof pic_vm_proc[0]; ++i) {
+    pic_dict_set(pic, pic->vmprocs, pic_intern_cstr(pic, pic_vm_proc[i].name), pic_int_value(pic, i));
+  }
+
   pic_defun(pic, "eval", pic_eval_eval);
 }
@@ -5,6 +5,14 @@
 #include "picrin.h"
 #include "picrin/private/state.h"
 
+#if PIC_USE_MMAP
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
 #ifndef EOF
 # define EOF (-1)
 #endif
@@ -20,7 +28,9 @@ xFILE *xfunopen(pic_state *pic, void *cookie, int (*read)(pic_state *, void *, c
     return NULL;
 
   fp->cnt = 0;
+  fp->ptr = NULL;
   fp->base = NULL;
+  fp->bufsiz = XBUFSIZ;
   fp->flag = read? X_READ : X_WRITE;
 
   fp->vtable.cookie = cookie;
@@ -34,12 +44,33 @@ xFILE *xfunopen(pic_state *pic, void *cookie, int (*read)(pic_state *, void *, c
 
 int xfclose(pic_state *pic, xFILE *fp) {
   xfflush(pic, fp);
-  fp->flag = 0;
-  if (fp->base != fp->buf)
+  if (fp->base != fp->buf && (fp->flag & X_EXTBUF) == 0)
     pic_free(pic, fp->base);
+  fp->flag = 0;
   return fp->vtable.close(pic, fp->vtable.cookie);
 }
 
+int xsetvbuf(pic_state *PIC_UNUSED(pic), xFILE *fp, int mode, int size) {
+  if (fp->base != NULL || size < 0)
+    return -1;                  /* too late, the buffer is in use */
+
+  fp->flag &= ~(X_UNBUF | X_LNBUF);
+  switch (mode) {
+  case XIONBF:
+    fp->flag |= X_UNBUF;
+    break;
+  case XIOLBF:
+    fp->flag |= X_LNBUF;
+    /* fall through */
+  case XIOFBF:
+    fp->bufsiz = size ? size : XBUFSIZ;
+    break;
+  default:
+    return -1;
+  }
+  return 0;
+}
+
 void xclearerr(pic_state *PIC_UNUSED(pic), xFILE *fp) {
   fp->flag &= ~(X_EOF | X_ERR);
 }
@@ -60,7 +91,7 @@ int x_fillbuf(pic_state *pic, xFILE *fp) {
   if (fp->base == NULL) {
     if ((fp->flag & X_UNBUF) == 0) {
       /* no buffer yet */
-      if ((fp->base = pic_malloc(pic, XBUFSIZ)) == NULL) {
+      if ((fp->base = pic_malloc(pic, fp->bufsiz)) == NULL) {
         /* can't get buffer, try unbuffered */
         fp->flag |= X_UNBUF;
       }
@@ -69,7 +100,7 @@ int x_fillbuf(pic_state *pic, xFILE *fp) {
       fp->base = fp->buf;
     }
   }
-  bufsize = (fp->flag & X_UNBUF) ? sizeof(fp->buf) : XBUFSIZ;
+  bufsize = (fp->flag & X_UNBUF) ? (int)sizeof(fp->buf) : fp->bufsiz;
 
   fp->ptr = fp->base;
   fp->cnt = fp->vtable.read(pic, fp->vtable.cookie, fp->ptr, bufsize);
@@ -94,12 +125,12 @@ int x_flushbuf(pic_state *pic, int x, xFILE *fp) {
     return EOF;
   if (fp->base == NULL && ((fp->flag & X_UNBUF) == 0)) {
     /* no buffer yet */
-    if ((fp->base = pic_malloc(pic, XBUFSIZ)) == NULL) {
+    if ((fp->base = pic_malloc(pic, fp->bufsiz)) == NULL) {
       /* couldn't allocate a buffer, so try unbuffered */
       fp->flag |= X_UNBUF;
     } else {
       fp->ptr = fp->base;
-      fp->cnt = XBUFSIZ - 1;
+      fp->cnt = fp->bufsiz - 1;
     }
   }
   if (fp->flag & X_UNBUF) {
@@ -126,7 +157,7 @@ int x_flushbuf(pic_state *pic, int x, xFILE *fp) {
     }
 
     fp->ptr = fp->base;
-    fp->cnt = XBUFSIZ - 1;
+    fp->cnt = fp->bufsiz - 1;
   }
 
   if (num_written == bufsize) {
@@ -176,13 +207,11 @@ int xfgetc(pic_state *pic, xFILE *fp) {
 }
 
 int xfputs(pic_state *pic, const char *s, xFILE *stream) {
-  const char *ptr = s;
-  while(*ptr != '\0') {
-    if (xputc(pic, *ptr, stream) == EOF)
-      return EOF;
-    ++ptr;
-  }
-  return (int)(ptr - s);
+  size_t n = strlen(s);
+
+  if (xfwrite(pic, s, 1, n, stream) < n)
+    return EOF;
+  return (int)n;
 }
 
 char *xfgets(pic_state *pic, char *s, int size, xFILE *stream) {
@@ -210,50 +239,96 @@ int xungetc(pic_state *PIC_UNUSED(pic), int c, xFILE *fp) {
   if (c == EOF || fp->base == fp->ptr) {
     return EOF;
   }
+  if ((unsigned char) fp->ptr[-1] != uc) {
+    if (fp->flag & X_EXTBUF)
+      return EOF;               /* may be read-only */
+    fp->ptr[-1] = uc;
+  }
   fp->cnt++;
-  return *--fp->ptr = uc;
+  fp->ptr--;
+  return uc;
+}
+
+/* bulk transfers go through the buffer only as far as they have to: the part
+   that is already buffered is copied with memcpy, and whatever is left of a
+   request at least as large as the buffer is handed to the vtable directly. */
+
+static int x_chunk(long n) {
+  return n > INT_MAX ? INT_MAX : (int)n;
 }
 
 size_t xfread(pic_state *pic, void *ptr, size_t size, size_t count, xFILE *fp) {
   char *bptr = ptr;
-  long nbytes;
-  int c;
-
-  nbytes = size * count;
-  while (nbytes > fp->cnt) {
-    memcpy(bptr, fp->ptr, fp->cnt);
-    fp->ptr += fp->cnt;
-    bptr += fp->cnt;
-    nbytes -= fp->cnt;
-    if ((c = x_fillbuf(pic, fp)) == EOF) {
-      return (size * count - nbytes) / size;
-    } else {
-      xungetc(pic, c, fp);
+  long nbytes, n;
+  int c, t;
+
+  if ((nbytes = size * count) == 0)
+    return 0;
+
+  while (nbytes > 0) {
+    if (fp->cnt > 0) {
+      n = nbytes < fp->cnt ? nbytes : fp->cnt;
+      memcpy(bptr, fp->ptr, n);
+      fp->ptr += n;
+      fp->cnt -= n;
+      bptr += n;
+      nbytes -= n;
+    }
+    else if (nbytes >= fp->bufsiz || (fp->flag & X_UNBUF)) {
+      /* read straight into the caller's memory */
+      if ((fp->flag & (X_READ|X_EOF|X_ERR)) != X_READ)
+        break;
+      t = fp->vtable.read(pic, fp->vtable.cookie, bptr, x_chunk(nbytes));
+      if (t <= 0) {
+        fp->flag |= t == 0 ? X_EOF : X_ERR;
+        break;
+      }
+      bptr += t;
+      nbytes -= t;
+    }
+    else {
+      if ((c = x_fillbuf(pic, fp)) == EOF)
+        break;
+      *bptr++ = c;
+      nbytes--;
     }
   }
-  memcpy(bptr, fp->ptr, nbytes);
-  fp->ptr += nbytes;
-  fp->cnt -= nbytes;
-  return count;
+  return (size * count - nbytes) / size;
 }
 
 size_t xfwrite(pic_state *pic, const void *ptr, size_t size, size_t count, xFILE *fp) {
   const char *bptr = ptr;
-  long nbytes;
-
-  nbytes = size * count;
-  while (nbytes > fp->cnt) {
-    memcpy(fp->ptr, bptr, fp->cnt);
-    fp->ptr += fp->cnt;
-    bptr += fp->cnt;
-    nbytes -= fp->cnt;
-    if (x_flushbuf(pic, EOF, fp) == EOF) {
-      return (size * count - nbytes) / size;
+  long nbytes, done;
+  int t;
+
+  if ((nbytes = size * count) == 0)
+    return 0;
+
+  if (nbytes > fp->cnt) {
+    /* make room; this also allocates the buffer on first use */
+    if (xfflush(pic, fp) != 0)
+      return 0;
+  }
+  if (nbytes <= fp->cnt) {
+    memcpy(fp->ptr, bptr, nbytes);
+    fp->ptr += nbytes;
+    fp->cnt -= nbytes;
+  }
+  else {
+    /* too large to be worth buffering */
+    for (done = 0; done < nbytes; done += t) {
+      t = fp->vtable.write(pic, fp->vtable.cookie, bptr + done, x_chunk(nbytes - done));
+      if (t <= 0) {
+        fp->flag |= X_ERR;
+        return done / size;
+      }
     }
+    return count;
+  }
+  if ((fp->flag & X_LNBUF) && memchr(bptr, '\n', nbytes) != NULL) {
+    if (xfflush(pic, fp) != 0)
+      return 0;
   }
-  memcpy(fp->ptr, bptr, nbytes);
-  fp->ptr += nbytes;
-  fp->cnt -= nbytes;
   return count;
 }
 
@@ -262,11 +337,14 @@ long xfseek(pic_state *pic, xFILE *fp, long offset, int whence) {
 
   xfflush(pic, fp);
 
+  if (whence == XSEEK_CUR && (fp->flag & X_READ) && fp->cnt > 0) {
+    offset -= fp->cnt;          /* the backend is ahead by what is buffered */
+  }
   fp->ptr = fp->base;
   fp->cnt = 0;
 
-  if ((s = fp->vtable.seek(pic, fp->vtable.cookie, offset, whence)) != 0)
-    return s;
+  if ((s = fp->vtable.seek(pic, fp->vtable.cookie, offset, whence)) < 0)
+    return s;                   /* backends return the new position */
   fp->flag &= ~X_EOF;
   return 0;
 }
@@ -371,8 +449,6 @@ file_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
   FILE *file = cookie;
   int r;
 
-  size = 1;                     /* override size */
-
   r = (int)fread(ptr, 1, (size_t)size, file);
   if (r < size && ferror(file)) {
     return -1;
@@ -432,6 +508,110 @@ xFILE *xfopen_file(pic_state *pic, FILE *fp, const char *mode) {
 
 #endif
 
+/* a region of memory the port does not own (a mapped file, a bytevector, a C
+   string) serves as the port's buffer as it is, so reads never reach the
+   backend and seeking only moves the buffer pointer. */
+
+struct region {
+  xFILE *fp;
+  const char *addr;
+  long len;
+  bool mapped;
+};
+
+static int
+region_read(pic_state *PIC_UNUSED(pic), void *PIC_UNUSED(cookie), char *PIC_UNUSED(ptr), int PIC_UNUSED(size)) {
+  return 0;
+}
+
+static long
+region_seek(pic_state *PIC_UNUSED(pic), void *cookie, long pos, int whence) {
+  struct region *m = cookie;
+
+  switch (whence) {
+  case XSEEK_CUR:
+  case XSEEK_END:
+    pos += m->len;              /* the backend is always at the end */
+    break;
+  }
+  if (pos < 0 || pos > m->len)
+    return -1;
+  m->fp->ptr = m->fp->base + pos;
+  m->fp->cnt = m->len - pos;
+  return pos;
+}
+
+static int
+region_close(pic_state *pic, void *cookie) {
+  struct region *m = cookie;
+  int r = 0;
+
+#if PIC_USE_MMAP
+  if (m->mapped)
+    r = munmap((void *)m->addr, m->len);
+#endif
+  pic_free(pic, m);
+  return r;
+}
+
+static xFILE *
+region_open(pic_state *pic, const char *addr, long len, bool mapped) {
+  struct region *m;
+  xFILE *file;
+
+  m = pic_malloc(pic, sizeof(struct region));
+  m->addr = addr;
+  m->len = len;
+  m->mapped = mapped;
+
+  if ((file = xfunopen(pic, m, region_read, NULL, region_seek, region_close)) == NULL) {
+    region_close(pic, m);
+    return NULL;
+  }
+  m->fp = file;
+  file->base = file->ptr = len > 0 ? (char *)addr : file->buf;
+  file->cnt = len;
+  file->flag |= X_EXTBUF;
+  return file;
+}
+
+xFILE *xfopen_mem(pic_state *pic, const char *buf, int len) {
+  return region_open(pic, buf, len, false);
+}
+
+#if PIC_USE_MMAP
+
+xFILE *xfopen_mmap(pic_state *pic, const char *path) {
+  struct stat st;
+  void *addr = NULL;
+  xFILE *file;
+  int fd;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return NULL;
+  if (fstat(fd, &st) < 0 || ! S_ISREG(st.st_mode) || st.st_size > LONG_MAX) {
+    close(fd);
+    return NULL;
+  }
+  if (st.st_size > 0) {
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);                    /* the mapping keeps the file open */
+  if (addr == MAP_FAILED)
+    return NULL;
+#ifdef MADV_SEQUENTIAL
+  if (addr != NULL)
+    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+#endif
+
+  if ((file = region_open(pic, addr, st.st_size, addr != NULL)) == NULL && addr != NULL) {
+    munmap(addr, st.st_size);
+  }
+  return file;
+}
+
+#endif
+
 typedef struct { char *buf; long pos, end, capa; } xbuf_t;
 
 static int
@@ -528,6 +708,25 @@ int xfget_buf(pic_state *pic, xFILE *file, const char **buf, int *len) {
   return 0;
 }
 
+int xftake_buf(pic_state *pic, xFILE *file, char **buf, int *len) {
+  xbuf_t *s;
+
+  xfflush(pic, file);
+
+  if (file->vtable.write != string_write) {
+    return -1;
+  }
+  s = file->vtable.cookie;
+  if (s->end > 0 && s->end < s->capa) {
+    s->buf = pic_realloc(pic, s->buf, s->end);
+  }
+  *len = s->end;
+  *buf = s->buf;
+  s->buf = NULL;
+  s->pos = s->end = s->capa = 0;
+  return 0;
+}
+
 static int
 null_read(pic_state *PIC_UNUSED(pic), void *PIC_UNUSED(cookie), char *PIC_UNUSED(ptr), int PIC_UNUSED(size)) {
   return 0;
@@ -23,14 +23,48 @@ struct heap_page {
   struct heap_page *next;
 };
 
+/* pairs are kept apart in fixed-size cells that carry no allocator header.
+   pair pages are aligned to PIC_PAIR_PAGE_SIZE, so a cell reaches its page,
+   and thus its mark bit, by masking the address. */
+
+union pair_cell {
+  struct pair pair;
+  union pair_cell *next;
+};
+
+#define MARK_BITS (sizeof(unsigned long) * 8)
+#define PAIR_PAGE_MAX_CELLS (PIC_PAIR_PAGE_SIZE / sizeof(union pair_cell))
+
+struct pair_page {
+  struct pair_page *next;
+  size_t used;                  /* cells handed out so far; the rest were never touched */
+  unsigned long marks[(PAIR_PAGE_MAX_CELLS + MARK_BITS - 1) / MARK_BITS];
+};
+
+struct pair_chunk {
+  void *base;
+  struct pair_chunk *next;
+};
+
+#define PAIR_PAGE_CELLS ((PIC_PAIR_PAGE_SIZE - sizeof(struct pair_page)) / sizeof(union pair_cell))
+
+#define pair_page_of(obj) ((struct pair_page *)((uintptr_t)(obj) & ~(uintptr_t)(PIC_PAIR_PAGE_SIZE - 1)))
+#define pair_page_cells(page) ((union pair_cell *)((page) + 1))
+
 struct object {
   union {
     struct basic basic;
     struct identifier id;
     struct string str;
     struct blob blob;
+    struct bignum big;
+    struct uvector uvec;
+    struct table table;
     struct pair pair;
     struct vector vec;
+#if PIC_WORD_BOXING
+    struct flonum flo;
+#endif
     struct dict dict;
     struct weak weak;
     struct data data;
@@ -47,7 +81,12 @@ struct object {
 struct heap {
   union header base, *freep;
   struct heap_page *pages;
+  union pair_cell *pair_freep;
+  struct pair_page *pair_pages;
+  struct pair_page *pair_fresh; /* first page that may have untouched cells */
+  struct pair_chunk *pair_chunks;
   struct weak *weaks;       /* weak map chain */
+  struct table *tables;     /* weak hash table chain */
 };
 
 struct heap *
@@ -63,7 +102,13 @@ pic_heap_open(pic_state *pic)
   heap->freep = &heap->base;
   heap->pages = NULL;
 
+  heap->pair_freep = NULL;
+  heap->pair_pages = NULL;
+  heap->pair_fresh = NULL;
+  heap->pair_chunks = NULL;
+
   heap->weaks = NULL;
+  heap->tables = NULL;
 
   return heap;
 }
@@ -72,6 +117,7 @@ void
 pic_heap_close(pic_state *pic, struct heap *heap)
 {
   struct heap_page *page;
+  struct pair_chunk *chunk;
 
   while (heap->pages) {
     page = heap->pages;
@@ -79,6 +125,12 @@ pic_heap_close(pic_state *pic, struct heap *heap)
     pic_free(pic, page->basep);
     pic_free(pic, page);
   }
+  while (heap->pair_chunks) {
+    chunk = heap->pair_chunks;
+    heap->pair_chunks = heap->pair_chunks->next;
+    pic_free(pic, chunk->base);
+    pic_free(pic, chunk);
+  }
   pic_free(pic, heap);
 }
 
@@ -257,8 +309,88 @@ heap_morecore(pic_state *pic)
   pic->heap->pages = page;
 }
 
+/* pages are carved into cells as they are needed rather than threaded onto
+   the free list up front, so that a fresh heap is cheap to make and to sweep */
+static void *
+pair_alloc(pic_state *pic)
+{
+  struct heap *heap = pic->heap;
+  union pair_cell *cell;
+  struct pair_page *page;
+
+  cell = heap->pair_freep;
+  if (cell != NULL) {
+    heap->pair_freep = cell->next;
+    return cell;
+  }
+  for (page = heap->pair_fresh; page != NULL; page = page->next) {
+    if (page->used < PAIR_PAGE_CELLS) {
+      heap->pair_fresh = page;
+      return &pair_page_cells(page)[page->used++];
+    }
+  }
+  heap->pair_fresh = NULL;
+  return NULL;
+}
+
+static void
+pair_morecore(pic_state *pic)
+{
+  struct pair_chunk *chunk;
+  struct pair_page *page;
+  uintptr_t p;
+  size_t n, i;
+
+  /* carve n aligned pair pages out of one block; at most a page is lost to alignment */
+  n = PIC_HEAP_PAGE_SIZE / PIC_PAIR_PAGE_SIZE;
+  if (n == 0) {
+    n = 1;
+  }
+
+  chunk = pic_malloc(pic, sizeof(struct pair_chunk));
+  chunk->base = pic_malloc(pic, PIC_PAIR_PAGE_SIZE * (n + 1));
+  chunk->next = pic->heap->pair_chunks;
+  pic->heap->pair_chunks = chunk;
+
+  p = ((uintptr_t)chunk->base + PIC_PAIR_PAGE_SIZE - 1) & ~(uintptr_t)(PIC_PAIR_PAGE_SIZE - 1);
+
+  for (i = 0; i < n; ++i, p += PIC_PAIR_PAGE_SIZE) {
+    page = (struct pair_page *)p;
+    page->used = 0;
+    memset(page->marks, 0, sizeof page->marks);
+    page->next = pic->heap->pair_pages;
+    pic->heap->pair_pages = page;
+  }
+  pic->heap->pair_fresh = pic->heap->pair_pages;
+}
+
 /* MARK */
 
+static bool
+gc_is_marked(struct object *obj)
+{
+  if (obj->u.basic.tt == PIC_TYPE_PAIR) {
+    struct pair_page *page = pair_page_of(obj);
+    size_t i = (union pair_cell *)obj - pair_page_cells(page);
+
+    return (page->marks[i / MARK_BITS] >> (i % MARK_BITS)) & 1;
+  }
+  return obj->u.basic.gc_mark == BLACK;
+}
+
+static void
+gc_set_mark(struct object *obj)
+{
+  if (obj->u.basic.tt == PIC_TYPE_PAIR) {
+    struct pair_page *page = pair_page_of(obj);
+    size_t i = (union pair_cell *)obj - pair_page_cells(page);
+
+    page->marks[i / MARK_BITS] |= 1ul << (i % MARK_BITS);
+    return;
+  }
+  obj->u.basic.gc_mark = BLACK;
+}
+
 static void gc_mark_object(pic_state *, struct object *);
 
 static void
@@ -275,10 +407,10 @@ gc_mark_object(pic_state *pic, struct object *obj)
 {
  loop:
 
-  if (obj->u.basic.gc_mark == BLACK)
+  if (gc_is_marked(obj))
     return;
 
-  obj->u.basic.gc_mark = BLACK;
+  gc_set_mark(obj);
 
 #define LOOP(o) obj = (struct object *)(o); goto loop
 
@@ -315,6 +447,9 @@ gc_mark_object(pic_state *pic, struct object *obj)
     break;
   }
   case PIC_TYPE_PORT: {
+    if (obj->u.port.owner) {
+      LOOP(obj->u.port.owner);
+    }
     break;
   }
   case PIC_TYPE_ERROR: {
@@ -337,6 +472,14 @@ gc_mark_object(pic_state *pic, struct object *obj)
   case PIC_TYPE_BLOB: {
     break;
   }
+  case PIC_TYPE_FLOAT:
+  case PIC_TYPE_BIGNUM: {
+    break;
+  }
+  case PIC_TYPE_UVECTOR: {
+    LOOP(obj->u.uvec.blob);
+    break;
+  }
   case PIC_TYPE_ID: {
     gc_mark_object(pic, (struct object *)obj->u.id.u.id);
     LOOP(obj->u.id.env);
@@ -391,6 +534,22 @@ gc_mark_object(pic_state *pic, struct object *obj)
     pic->heap->weaks = weak;
     break;
   }
+  case PIC_TYPE_TABLE: {
+    struct table *t = &obj->u.table;
+    pic_value key, val;
+    int it = 0;
+
+    if (t->weak) {
+      t->prev = pic->heap->tables;
+      pic->heap->tables = t;
+      break;
+    }
+    while (pic_table_next(pic, pic_obj_value(t), &it, &key, &val)) {
+      gc_mark(pic, key);
+      gc_mark(pic, val);
+    }
+    break;
+  }
   case PIC_TYPE_CP: {
     if (obj->u.cp.prev) {
       gc_mark_object(pic, (struct object *)obj->u.cp.prev);
@@ -418,6 +577,7 @@ gc_mark_phase(pic_state *pic)
   size_t j;
 
   assert(pic->heap->weaks == NULL);
+  assert(pic->heap->tables == NULL);
 
   /* checkpoint */
   if (pic->cp) {
@@ -455,12 +615,22 @@ gc_mark_phase(pic_state *pic)
   /* macro objects */
   gc_mark(pic, pic->macros);
 
+  /* compile-time effects */
+  gc_mark(pic, pic->journal);
+
   /* error object */
   gc_mark(pic, pic->err);
 
   /* features */
   gc_mark(pic, pic->features);
 
+  /* keywords */
+#define M(slot) if (pic->slot) gc_mark_object(pic, (struct object *)pic->slot)
+  M(sDEFINE); M(sDEFINE_MACRO); M(sLAMBDA); M(sQUOTE); M(sBEGIN); M(sSETBANG); M(sIF);
+  M(sGREF); M(sCREF); M(sLREF); M(sCALL);
+#undef M
+  gc_mark(pic, pic->vmprocs);
+
   /* library table */
   for (it = kh_begin(&pic->ltable); it != kh_end(&pic->ltable); ++it) {
     if (! kh_exist(&pic->ltable, it)) {
@@ -478,6 +648,7 @@ gc_mark_phase(pic_state *pic)
     int it;
     khash_t(weak) *h;
     struct weak *weak;
+    struct table *t;
 
     j = 0;
     weak = pic->heap->weaks;
@@ -489,8 +660,8 @@ gc_mark_phase(pic_state *pic)
           continue;
         key = kh_key(h, it);
         val = kh_val(h, it);
-        if (key->u.basic.gc_mark == BLACK) {
-          if (pic_obj_p(pic, val) && pic_obj_ptr(val)->u.basic.gc_mark == WHITE) {
+        if (gc_is_marked(key)) {
+          if (pic_obj_p(pic, val) && ! gc_is_marked(pic_obj_ptr(val))) {
             gc_mark(pic, val);
             ++j;
           }
@@ -498,6 +669,20 @@ gc_mark_phase(pic_state *pic)
       }
       weak = weak->prev;
     }
+
+    for (t = pic->heap->tables; t != NULL; t = t->prev) {
+      pic_value k;
+
+      it = 0;
+      while (pic_table_next(pic, pic_obj_value(t), &it, &k, &val)) {
+        if (pic_obj_p(pic, k) && ! gc_is_marked(pic_obj_ptr(k)))
+          continue;
+        if (pic_obj_p(pic, val) && ! gc_is_marked(pic_obj_ptr(val))) {
+          gc_mark(pic, val);
+          ++j;
+        }
+      }
+    }
   } while (j > 0);
 }
 
@@ -508,15 +693,21 @@ gc_finalize_object(pic_state *pic, struct object *obj)
 {
   switch (obj->u.basic.tt) {
   case PIC_TYPE_VECTOR: {
-    pic_free(pic, obj->u.vec.data);
+    if (obj->u.vec.data != obj->u.vec.storage) {
+      pic_free(pic, obj->u.vec.data);
+    }
     break;
   }
   case PIC_TYPE_BLOB: {
-    pic_free(pic, obj->u.blob.data);
+    if (obj->u.blob.data != obj->u.blob.storage) {
+      pic_free(pic, obj->u.blob.data);
+    }
     break;
   }
   case PIC_TYPE_STRING: {
-    pic_rope_decref(pic, obj->u.str.rope);
+    if (obj->u.str.inline_len == 0) {
+      pic_rope_decref(pic, obj->u.str.u.rope);
+    }
     break;
   }
   case PIC_TYPE_ENV: {
@@ -545,7 +736,17 @@ gc_finalize_object(pic_state *pic, struct object *obj)
     pic_irep_decref(pic, obj->u.proc.u.i.irep);
     break;
   }
+  case PIC_TYPE_TABLE: {
+    pic_free(pic, obj->u.table.cur.ents);
+    if (obj->u.table.old.ents) {
+      pic_free(pic, obj->u.table.old.ents);
+    }
+    break;
+  }
 
+  case PIC_TYPE_FLOAT:
+  case PIC_TYPE_BIGNUM:
+  case PIC_TYPE_UVECTOR:
   case PIC_TYPE_PAIR:
   case PIC_TYPE_CXT:
   case PIC_TYPE_PORT:
@@ -603,10 +804,31 @@ gc_sweep_page(pic_state *pic, struct heap_page *page)
   return alive;
 }
 
+static size_t
+gc_sweep_pair_page(pic_state *pic, struct pair_page *page)
+{
+  union pair_cell *cells = pair_page_cells(page);
+  size_t i, alive = 0;
+
+  /* pairs need no finalization; unmarked cells simply go back to the free list */
+  for (i = page->used; i-- > 0;) {
+    if ((page->marks[i / MARK_BITS] >> (i % MARK_BITS)) & 1) {
+      alive++;
+    } else {
+      cells[i].next = pic->heap->pair_freep;
+      pic->heap->pair_freep = &cells[i];
+    }
+  }
+  memset(page->marks, 0, sizeof page->marks);
+
+  return alive;
+}
+
 static void
 gc_sweep_phase(pic_state *pic)
 {
   struct heap_page *page;
+  struct pair_page *pair_page;
   int it;
   khash_t(weak) *h;
   khash_t(oblist) *s = &pic->oblist;
@@ -621,13 +843,28 @@ gc_sweep_phase(pic_state *pic)
       if (! kh_exist(h, it))
         continue;
       obj = kh_key(h, it);
-      if (obj->u.basic.gc_mark == WHITE) {
+      if (! gc_is_marked(obj)) {
         kh_del(weak, h, it);
       }
     }
     pic->heap->weaks = pic->heap->weaks->prev;
   }
 
+  /* weak hash tables */
+  while (pic->heap->tables != NULL) {
+    struct table *t = pic->heap->tables;
+    struct table_ent *e;
+
+    for (it = 0; it < t->old.capa + t->cur.capa; ++it) {
+      e = it < t->old.capa ? &t->old.ents[it] : &t->cur.ents[it - t->old.capa];
+      if (e->hash > 1 && pic_obj_p(pic, e->key) && ! gc_is_marked(pic_obj_ptr(e->key))) {
+        e->hash = 1;            /* deleted */
+        t->size--;
+      }
+    }
+    pic->heap->tables = t->prev;
+  }
+
   /* symbol table */
   for (it = kh_begin(s); it != kh_end(s); ++it) {
     if (! kh_exist(s, it))
@@ -648,6 +885,17 @@ gc_sweep_phase(pic_state *pic)
   if (PIC_PAGE_REQUEST_THRESHOLD(total) <= inuse) {
     heap_morecore(pic);
   }
+
+  total = inuse = 0;
+  pic->heap->pair_freep = NULL;
+  for (pair_page = pic->heap->pair_pages; pair_page != NULL; pair_page = pair_page->next) {
+    inuse += gc_sweep_pair_page(pic, pair_page);
+    total += PAIR_PAGE_CELLS;
+  }
+
+  if (PIC_PAGE_REQUEST_THRESHOLD(total) <= inuse) {
+    pair_morecore(pic);
+  }
 }
 
 void
@@ -659,6 +907,8 @@ pic_gc(pic_state *pic)
 
   gc_mark_phase(pic);
   gc_sweep_phase(pic);
+
+  pic_flush_idcache(pic);
 }
 
 void *
@@ -679,15 +929,29 @@ pic_obj_alloc_unsafe(pic_state *pic, size_t size, int type)
   pic_gc(pic);
 #endif
 
-  obj = (struct object *)heap_alloc(pic, size);
-  if (obj == NULL) {
-    pic_gc(pic);
+  if (type == PIC_TYPE_PAIR) {
+    assert(size <= sizeof(union pair_cell));
+
+    obj = (struct object *)pair_alloc(pic);
+    if (obj == NULL) {
+      pic_gc(pic);
+      obj = (struct object *)pair_alloc(pic);
+      if (obj == NULL) {
+        pair_morecore(pic);
+        obj = (struct object *)pair_alloc(pic);
+      }
+    }
+  } else {
     obj = (struct object *)heap_alloc(pic, size);
     if (obj == NULL) {
-      heap_morecore(pic);
+      pic_gc(pic);
       obj = (struct object *)heap_alloc(pic, size);
-      if (obj == NULL)
-	pic_panic(pic, "GC memory exhausted");
+      if (obj == NULL) {
+        heap_morecore(pic);
+        obj = (struct object *)heap_alloc(pic, size);
+        if (obj == NULL)
+          pic_panic(pic, "GC memory exhausted");
+      }
     }
   }
   obj->u.basic.gc_mark = WHITE;
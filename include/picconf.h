@@ -11,6 +11,12 @@
 /** enable some specific features? */
 /* #define PIC_USE_WRITE 1 */
 
+/** map input files into memory (needs POSIX mmap) */
+/* #define PIC_USE_MMAP 1 */
+
+/** represent values as low-bit tagged words (62-bit fixnums, boxed flonums) */
+/* #define PIC_WORD_BOXING 1 */
+
 /** essential external functions */
 /* #define PIC_JMPBUF jmp_buf */
 /* #define PIC_SETJMP(pic, buf) setjmp(buf) */
@@ -20,6 +26,7 @@
 /** initial memory size (to be dynamically extended if necessary) */
 /* #define PIC_ARENA_SIZE 1000 */
 /* #define PIC_HEAP_PAGE_SIZE 10000 */
+/* #define PIC_PAIR_PAGE_SIZE 65536 */
 /* #define PIC_PAGE_REQUEST_THRESHOLD(total) ((total) * 77 / 100) */
 /* #define PIC_STACK_SIZE 1024 */
 /* #define PIC_RESCUE_SIZE 30 */
@@ -28,3 +35,19 @@
 /* #define PIC_POOL_SIZE 8 */
 /* #define PIC_SYMS_SIZE 32 */
 /* #define PIC_ISEQ_SIZE 1024 */
+
+/** vectors and bytevectors up to this length keep their payload in the object cell */
+/* #define PIC_VEC_INLINE_SIZE 16 */
+/* #define PIC_BLOB_INLINE_SIZE 128 */
+
+/** concatenated strings shorter than this are copied into a single rope leaf */
+/* #define PIC_ROPE_LEAF_SIZE 128 */
+
+/** strings shorter than this are stored in the string object itself (at most 255) */
+/* #define PIC_STR_INLINE_SIZE 16 */
+
+/** number of entries in the identifier resolution cache (a power of two) */
+/* #define PIC_IDCACHE_SIZE 256 */
+
+/** internal hash tables probe groups of control bytes (SSE2 when available) instead of khash's bitmaps */
+/* #define PIC_SWISS_TABLE 1 */
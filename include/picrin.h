@@ -39,6 +39,9 @@ typedef struct pic_state pic_state;
 #if PIC_NAN_BOXING
 # include <stdint.h>
 typedef uint64_t pic_value;
+#elif PIC_WORD_BOXING
+# include <stdint.h>
+typedef uint64_t pic_value;
 #else
 typedef struct {
   unsigned char type;
@@ -46,11 +49,21 @@ typedef struct {
     void *data;
     double f;
     int i;
-    char c;
+    int c;
   } u;
 } pic_value;
 #endif
 
+#if PIC_WORD_BOXING
+typedef int64_t pic_fixnum_t;
+# define PIC_FIXNUM_MAX (((int64_t)1 << 61) - 1)
+# define PIC_FIXNUM_MIN (-((int64_t)1 << 61))
+#else
+typedef int pic_fixnum_t;
+# define PIC_FIXNUM_MAX INT_MAX
+# define PIC_FIXNUM_MIN INT_MIN
+#endif
+
 typedef void *(*pic_allocf)(void *userdata, void *ptr, size_t n);
 
 pic_state *pic_open(pic_allocf f, void *userdata);
@@ -118,8 +131,13 @@ xFILE *pic_fileno(pic_state *, pic_value port);
 void pic_close_port(pic_state *, pic_value port);
 
 int pic_int(pic_state *, pic_value i);
+#if PIC_WORD_BOXING
+pic_fixnum_t pic_fixnum(pic_state *, pic_value i);
+#else
+# define pic_fixnum(pic, i) pic_int(pic, i)
+#endif
 double pic_float(pic_state *, pic_value f);
-char pic_char(pic_state *, pic_value c);
+int pic_char(pic_state *, pic_value c);
 #define pic_bool(pic,b) (! pic_false_p(pic, b))
 const char *pic_str(pic_state *, pic_value str);
 #define pic_sym(pic,s) (pic_str(pic, pic_sym_name(pic, (s))))
@@ -135,8 +153,13 @@ typedef struct {
 pic_value pic_invalid_value(pic_state *);
 pic_value pic_undef_value(pic_state *);
 pic_value pic_int_value(pic_state *, int);
+#if PIC_WORD_BOXING
+pic_value pic_fixnum_value(pic_state *, pic_fixnum_t);
+#else
+# define pic_fixnum_value(pic, i) pic_int_value(pic, i)
+#endif
 pic_value pic_float_value(pic_state *, double);
-pic_value pic_char_value(pic_state *, char);
+pic_value pic_char_value(pic_state *, int);
 pic_value pic_true_value(pic_state *);
 pic_value pic_false_value(pic_state *);
 #define pic_bool_value(pic, b) ((b) ? pic_true_value(pic) : pic_false_value(pic))
@@ -164,6 +187,7 @@ enum {
   PIC_TYPE_STRING  = 16,
   PIC_TYPE_VECTOR  = 17,
   PIC_TYPE_BLOB    = 18,
+  PIC_TYPE_BIGNUM  = 19,
   PIC_TYPE_PORT    = 20,
   PIC_TYPE_ERROR   = 21,
   PIC_TYPE_ID      = 22,
@@ -177,12 +201,18 @@ enum {
   PIC_TYPE_CXT     = 30,
   PIC_TYPE_CP      = 31,
   PIC_TYPE_FUNC    = 32,
-  PIC_TYPE_IREP    = 33
+  PIC_TYPE_IREP    = 33,
+  PIC_TYPE_UVECTOR = 34,
+  PIC_TYPE_TABLE   = 35
 };
 
 #define pic_invalid_p(pic,v) (pic_type(pic,v) == PIC_TYPE_INVALID)
 #define pic_undef_p(pic,v) (pic_type(pic,v) == PIC_TYPE_UNDEF)
-#define pic_int_p(pic,v) (pic_type(pic,v) == PIC_TYPE_INT)
+#if PIC_WORD_BOXING
+# define pic_int_p(pic,v) (((v) & 3) == 1)
+#else
+# define pic_int_p(pic,v) (pic_type(pic,v) == PIC_TYPE_INT)
+#endif
 #define pic_float_p(pic,v) (pic_type(pic,v) == PIC_TYPE_FLOAT)
 #define pic_char_p(pic,v) (pic_type(pic,v) == PIC_TYPE_CHAR)
 #define pic_eof_p(pic, v) (pic_type(pic, v) == PIC_TYPE_EOF)
@@ -256,17 +286,20 @@ bool pic_weak_has(pic_state *, pic_value weak, pic_value key);
 
 /* symbol */
 pic_value pic_intern(pic_state *, pic_value str);
-#define pic_intern_str(pic,s,i) pic_intern(pic, pic_str_value(pic, (s), (i)))
-#define pic_intern_cstr(pic,s) pic_intern(pic, pic_cstr_value(pic, (s)))
-#define pic_intern_lit(pic,lit) pic_intern(pic, pic_lit_value(pic, lit))
+pic_value pic_intern_str(pic_state *, const char *str, int len); /* len < 0 for literals, as pic_str_value */
+#define pic_intern_cstr(pic,s) pic_intern_str(pic, (s), strlen(s))
+#define pic_intern_lit(pic,lit) pic_intern_str(pic, "" lit, -((int)sizeof lit - 1))
 pic_value pic_sym_name(pic_state *, pic_value sym);
 
 /* string */
-int pic_str_len(pic_state *, pic_value str);
-char pic_str_ref(pic_state *, pic_value str, int i);
+int pic_str_len(pic_state *, pic_value str); /* in characters */
+int pic_str_nbytes(pic_state *, pic_value str); /* length of the UTF-8 encoding */
+int pic_str_ref(pic_state *, pic_value str, int i);
 pic_value pic_str_cat(pic_state *, pic_value str1, pic_value str2);
 pic_value pic_str_sub(pic_state *, pic_value str, int i, int j);
 int pic_str_cmp(pic_state *, pic_value str1, pic_value str2);
+bool pic_str_equal_p(pic_state *, pic_value str1, pic_value str2);
+bool pic_str_prefix_p(pic_state *, pic_value prefix, pic_value str);
 int pic_str_hash(pic_state *, pic_value str);
 
 
@@ -277,11 +310,16 @@ int pic_str_hash(pic_state *, pic_value str);
 #define XSEEK_END 1
 #define XSEEK_SET 2
 
+#define XIOFBF 0
+#define XIOLBF 1
+#define XIONBF 2
+
 xFILE *xfunopen(pic_state *, void *cookie, int (*read)(pic_state *, void *, char *, int), int (*write)(pic_state *, void *, const char *, int), long (*seek)(pic_state *, void *, long, int), int (*close)(pic_state *, void *));
 size_t xfread(pic_state *, void *ptr, size_t size, size_t count, xFILE *fp);
 size_t xfwrite(pic_state *, const void *ptr, size_t size, size_t count, xFILE *fp);
 long xfseek(pic_state *, xFILE *fp, long offset, int whence);
 int xfclose(pic_state *, xFILE *fp);
+int xsetvbuf(pic_state *, xFILE *fp, int mode, int size); /* before any I/O; size 0 for the default */
 
 void xclearerr(pic_state *, xFILE *fp);
 int xfeof(pic_state *, xFILE *fp);
@@ -22,6 +22,14 @@ pic_value pic_eval(pic_state *, pic_value program, const char *lib);
 
 void pic_load(pic_state *, pic_value port);
 void pic_load_cstr(pic_state *, const char *);
+bool pic_load_compile(pic_state *, pic_value port, xFILE *out);
+bool pic_load_compiled(pic_state *, const unsigned char *buf, size_t len);
+#if PIC_USE_STDIO
+void pic_load_cached(pic_state *, const char *src, int len, const char *cachedir);
+#endif
+
+pic_state *pic_open_snapshot(pic_allocf, void *userdata, void (*init)(pic_state *), const unsigned char *buf, size_t len);
+void pic_snapshot(pic_state *, xFILE *out);
 
 #if PIC_USE_WRITE
 void pic_printf(pic_state *, const char *fmt, ...);
@@ -40,8 +48,15 @@ xFILE *xfile_xstderr(pic_state *);
 #if PIC_USE_STDIO
 xFILE *xfopen_file(pic_state *, FILE *, const char *mode);
 #endif
+#if PIC_USE_MMAP
+xFILE *xfopen_mmap(pic_state *, const char *path);
+#endif
 xFILE *xfopen_buf(pic_state *, const char *buf, int len, const char *mode);
 int xfget_buf(pic_state *, xFILE *file, const char **buf, int *len);
+int xftake_buf(pic_state *, xFILE *file, char **buf, int *len); /* caller frees buf with pic_free */
+xFILE *xfopen_mem(pic_state *, const char *buf, int len); /* reads buf in place */
+xFILE *xfopen_str(pic_state *);
+int xfget_str(pic_state *, xFILE *file, pic_value *str);
 xFILE *xfopen_null(pic_state *, const char *mode);
 
 /* port manipulation */
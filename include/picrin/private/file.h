@@ -5,7 +5,7 @@
 extern "C" {
 #endif
 
-#define XBUFSIZ 1024
+#define XBUFSIZ 8192
 #define XOPEN_MAX 1024
 
 struct xFILE {
@@ -14,6 +14,7 @@ struct xFILE {
   long cnt;                     /* characters left */
   char *ptr;                    /* next character position */
   char *base;                   /* location of the buffer */
+  int bufsiz;                   /* size of the buffer once allocated */
   /* operators */
   struct {
     void *cookie;
@@ -31,7 +32,8 @@ enum {
   X_UNBUF = 04,
   X_EOF   = 010,
   X_ERR   = 020,
-  X_LNBUF = 040
+  X_LNBUF = 040,
+  X_EXTBUF = 0100               /* buffer is owned by the backend */
 };
 
 
@@ -27,6 +27,265 @@
 #ifndef PICRIN_KHASH_H
 #define PICRIN_KHASH_H
 
+#define ac_roundup32(x)                                                 \
+  (--(x), (x)|=(x)>>1, (x)|=(x)>>2, (x)|=(x)>>4, (x)|=(x)>>8, (x)|=(x)>>16, ++(x))
+
+#if PIC_SWISS_TABLE
+
+/* swiss table: keys and values sit side by side in one slot array, and
+   a separate array holds one control byte per slot, which is EMPTY,
+   DELETED or the low 7 bits of the hash of the key in the slot. lookups
+   compare a whole group of control bytes against the wanted hash at once
+   (16 with SSE2, 8 otherwise) and touch the slots only on a match. the
+   first group is mirrored past the end of the control array so that a
+   group can be loaded starting at any slot. */
+
+#define kh__empty ((signed char)-128)
+#define kh__deleted ((signed char)-2)
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+# define KH_GROUP 16
+PIC_INLINE unsigned
+kh__match(const signed char *g, signed char c)
+{
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)g), _mm_set1_epi8(c)));
+}
+PIC_INLINE unsigned
+kh__match_free(const signed char *g) /* empty or deleted */
+{
+  return _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i *)g), _mm_set1_epi8(-1)));
+}
+#else
+# define KH_GROUP 8
+PIC_INLINE unsigned
+kh__match(const signed char *g, signed char c)
+{
+  unsigned m = 0;
+  int i;
+  for (i = 0; i < KH_GROUP; ++i) {
+    m |= (unsigned)(g[i] == c) << i;
+  }
+  return m;
+}
+PIC_INLINE unsigned
+kh__match_free(const signed char *g)
+{
+  unsigned m = 0;
+  int i;
+  for (i = 0; i < KH_GROUP; ++i) {
+    m |= (unsigned)(g[i] < -1) << i;
+  }
+  return m;
+}
+#endif
+#define kh__match_empty(g) kh__match(g, kh__empty)
+
+PIC_INLINE int
+kh__ctz(unsigned m)             /* m != 0 */
+{
+#if __GNUC__ || __clang__
+  return __builtin_ctz(m);
+#else
+  int i = 0;
+  while (! (m & 1)) { m >>= 1; ++i; }
+  return i;
+#endif
+}
+
+PIC_INLINE int
+kh__clz(unsigned m)             /* leading zeros within a group mask; m != 0 */
+{
+  int i = 0;
+  while (! (m & (1u << (KH_GROUP - 1 - i)))) ++i;
+  return i;
+}
+
+PIC_INLINE uint32_t
+kh__mix(int k)                  /* murmur3 fmix32; pointer hashes have poor low bits */
+{
+  uint32_t h = (uint32_t)k;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+  return h;
+}
+
+PIC_INLINE void
+kh__set_ctrl(signed char *ctrl, int n_buckets, int i, signed char c)
+{
+  ctrl[i] = c;
+  if (i < KH_GROUP) {
+    ctrl[n_buckets + i] = c;      /* mirror */
+  }
+}
+
+/* first free slot on the probe sequence of hash m */
+PIC_INLINE int
+kh__find_free(const signed char *ctrl, int n_buckets, uint32_t m)
+{
+  int mask = n_buckets - 1, i = (m >> 7) & mask, step = 0;
+  unsigned free;
+
+  while ((free = kh__match_free(ctrl + i)) == 0) {
+    step += KH_GROUP;
+    i = (i + step) & mask;
+  }
+  return (i + kh__ctz(free)) & mask;
+}
+
+#define kh__hash_upper(n) ((n) - (n) / 8)
+
+#define KHASH_DECLARE(name, khkey_t, khval_t)                           \
+  typedef struct {                                                      \
+    khkey_t key;                                                        \
+    khval_t val;                                                        \
+  } kh_##name##_slot_t;                                                 \
+  typedef struct {                                                      \
+    int n_buckets, size, n_occupied, upper_bound;                       \
+    signed char *ctrl;                                                  \
+    kh_##name##_slot_t *slots;                                          \
+  } kh_##name##_t;                                                      \
+  void kh_init_##name(kh_##name##_t *h);                                \
+  void kh_destroy_##name(pic_state *, kh_##name##_t *h);                \
+  void kh_clear_##name(kh_##name##_t *h);                               \
+  int kh_get_##name(pic_state *, const kh_##name##_t *h, khkey_t key);  \
+  void kh_resize_##name(pic_state *, kh_##name##_t *h, int new_n_buckets); \
+  int kh_put_##name(pic_state *, kh_##name##_t *h, khkey_t key, int *ret); \
+  void kh_del_##name(kh_##name##_t *h, int x);
+
+/* lookup with a key of another type, e.g. the bytes of a string key.
+   hash_func must agree with the table's own, hash_equal(stored, key) */
+#define KHASH_DEFINE_GET(name, getname, lookup_t, hash_func, hash_equal) \
+  int kh_##getname(pic_state *pic, const kh_##name##_t *h, lookup_t key) \
+  {                                                                     \
+    (void)pic;                                                          \
+    if (h->n_buckets) {                                                 \
+      uint32_t m = kh__mix(hash_func(key));                             \
+      int x, mask = h->n_buckets - 1, i = (m >> 7) & mask, step = 0;    \
+      unsigned match;                                                   \
+      while (1) {                                                       \
+        for (match = kh__match(h->ctrl + i, m & 0x7f); match; match &= match - 1) { \
+          x = (i + kh__ctz(match)) & mask;                              \
+          if (hash_equal(h->slots[x].key, key)) return x;               \
+        }                                                               \
+        if (kh__match_empty(h->ctrl + i)) return h->n_buckets;         \
+        step += KH_GROUP;                                               \
+        if (step > h->n_buckets) return h->n_buckets; /* all groups seen */ \
+        i = (i + step) & mask;                                          \
+      }                                                                 \
+    } else return 0;                                                    \
+  }
+
+#define KHASH_DEFINE(name, khkey_t, khval_t, hash_func, hash_equal)     \
+  KHASH_DEFINE2(name, khkey_t, khval_t, 1, hash_func, hash_equal)
+#define KHASH_DEFINE2(name, khkey_t, khval_t, kh_is_map, hash_func, hash_equal) \
+  void kh_init_##name(kh_##name##_t *h) {                               \
+    memset(h, 0, sizeof(kh_##name##_t));                                \
+  }                                                                     \
+  void kh_destroy_##name(pic_state *pic, kh_##name##_t *h)              \
+  {                                                                     \
+    pic_free(pic, h->ctrl);                                             \
+    pic_free(pic, h->slots);                                            \
+  }                                                                     \
+  void kh_clear_##name(kh_##name##_t *h)                                \
+  {                                                                     \
+    if (h->ctrl) {                                                      \
+      memset(h->ctrl, kh__empty, h->n_buckets + KH_GROUP);              \
+      h->size = h->n_occupied = 0;                                      \
+    }                                                                   \
+  }                                                                     \
+  KHASH_DEFINE_GET(name, get_##name, khkey_t, hash_func, hash_equal)    \
+  void kh_resize_##name(pic_state *pic, kh_##name##_t *h, int new_n_buckets) \
+  {                                                                     \
+    signed char *ctrl;                                                  \
+    kh_##name##_slot_t *slots;                                          \
+    int j, x;                                                           \
+    ac_roundup32(new_n_buckets);                                        \
+    if (new_n_buckets < KH_GROUP) new_n_buckets = KH_GROUP;             \
+    if (h->size >= kh__hash_upper(new_n_buckets)) return; /* requested size is too small */ \
+    ctrl = pic_malloc(pic, new_n_buckets + KH_GROUP);                   \
+    memset(ctrl, kh__empty, new_n_buckets + KH_GROUP);                  \
+    slots = pic_malloc(pic, new_n_buckets * sizeof(kh_##name##_slot_t)); \
+    for (j = 0; j != h->n_buckets; ++j) {                               \
+      if (h->ctrl[j] >= 0) {                                            \
+        uint32_t m = kh__mix(hash_func(h->slots[j].key));               \
+        x = kh__find_free(ctrl, new_n_buckets, m);                      \
+        kh__set_ctrl(ctrl, new_n_buckets, x, m & 0x7f);                 \
+        slots[x] = h->slots[j];                                         \
+      }                                                                 \
+    }                                                                   \
+    pic_free(pic, h->ctrl);                                             \
+    pic_free(pic, h->slots);                                            \
+    h->ctrl = ctrl;                                                     \
+    h->slots = slots;                                                   \
+    h->n_buckets = new_n_buckets;                                       \
+    h->n_occupied = h->size;                                            \
+    h->upper_bound = kh__hash_upper(new_n_buckets);                     \
+    (void)kh_is_map;                                                    \
+  }                                                                     \
+  int kh_put_##name(pic_state *pic, kh_##name##_t *h, khkey_t key, int *ret) \
+  {                                                                     \
+    uint32_t m;                                                         \
+    int x, mask, i, step = 0, site = -1;                                \
+    unsigned match;                                                     \
+    if (h->n_occupied >= h->upper_bound) { /* update the hash table */  \
+      if (h->n_buckets > (h->size<<1)) {                                \
+        kh_resize_##name(pic, h, h->n_buckets); /* clear "deleted" elements */ \
+      } else {                                                          \
+        kh_resize_##name(pic, h, h->n_buckets * 2); /* expand the hash table */ \
+      }                                                                 \
+    }                                                                   \
+    m = kh__mix(hash_func(key));                                        \
+    mask = h->n_buckets - 1;                                            \
+    i = (m >> 7) & mask;                                                \
+    while (1) {                                                         \
+      for (match = kh__match(h->ctrl + i, m & 0x7f); match; match &= match - 1) { \
+        x = (i + kh__ctz(match)) & mask;                                \
+        if (hash_equal(h->slots[x].key, key)) {                         \
+          *ret = 0; /* present; the slot is left as is */            \
+          return x;                                                     \
+        }                                                               \
+      }                                                                 \
+      if (site < 0 && (match = kh__match_free(h->ctrl + i)) != 0) {     \
+        site = (i + kh__ctz(match)) & mask;                             \
+      }                                                                 \
+      if (kh__match_empty(h->ctrl + i)) break;                          \
+      step += KH_GROUP;                                                 \
+      i = (i + step) & mask;                                            \
+    }                                                                   \
+    if (h->ctrl[site] == kh__empty) { /* not present at all */          \
+      ++h->n_occupied;                                                  \
+      *ret = 1;                                                         \
+    } else { /* deleted */                                              \
+      *ret = 2;                                                         \
+    }                                                                   \
+    kh__set_ctrl(h->ctrl, h->n_buckets, site, m & 0x7f);                \
+    h->slots[site].key = key;                                           \
+    ++h->size;                                                          \
+    return site;                                                        \
+  }                                                                     \
+  void kh_del_##name(kh_##name##_t *h, int x)                           \
+  {                                                                     \
+    if (x != h->n_buckets && h->ctrl[x] >= 0) {                         \
+      unsigned before, after;                                           \
+      before = kh__match_empty(h->ctrl + ((x - KH_GROUP) & (h->n_buckets - 1))); \
+      after = kh__match_empty(h->ctrl + x);                             \
+      /* no probe can have run past x unless it sits in a full group */ \
+      if (before && after && kh__ctz(after) + kh__clz(before) < KH_GROUP) { \
+        kh__set_ctrl(h->ctrl, h->n_buckets, x, kh__empty);              \
+        --h->n_occupied;                                                \
+      } else {                                                          \
+        kh__set_ctrl(h->ctrl, h->n_buckets, x, kh__deleted);            \
+      }                                                                 \
+      --h->size;                                                        \
+    }                                                                   \
+  }
+
+#else
+
 #define ac_isempty(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&2)
 #define ac_isdel(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&1)
 #define ac_iseither(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&3)
@@ -35,9 +294,6 @@
 #define ac_set_isboth_false(flag, i) (flag[i>>4]&=~(3ul<<((i&0xfU)<<1)))
 #define ac_set_isdel_true(flag, i) (flag[i>>4]|=1ul<<((i&0xfU)<<1))
 
-#define ac_roundup32(x)                                                 \
-  (--(x), (x)|=(x)>>1, (x)|=(x)>>2, (x)|=(x)>>4, (x)|=(x)>>8, (x)|=(x)>>16, ++(x))
-
 #define ac_fsize(m) ((m) < 16? 1 : (m)>>4)
 #define ac_hash_upper(x) ((((x) * 2) * 77 / 100 + 1) / 2)
 
@@ -56,6 +312,25 @@
   int kh_put_##name(pic_state *, kh_##name##_t *h, khkey_t key, int *ret); \
   void kh_del_##name(kh_##name##_t *h, int x);
 
+/* lookup with a key of another type, e.g. the bytes of a string key.
+   hash_func must agree with the table's own, hash_equal(stored, key) */
+#define KHASH_DEFINE_GET(name, getname, lookup_t, hash_func, hash_equal) \
+  int kh_##getname(pic_state *pic, const kh_##name##_t *h, lookup_t key) \
+  {                                                                     \
+    (void)pic;                                                          \
+    if (h->n_buckets) {                                                 \
+      int k, i, last, mask, step = 0;                                   \
+      mask = h->n_buckets - 1;                                          \
+      k = hash_func(key); i = k & mask;                                 \
+      last = i;                                                         \
+      while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
+        i = (i + (++step)) & mask;                                      \
+        if (i == last) return h->n_buckets;                             \
+      }                                                                 \
+      return ac_iseither(h->flags, i)? h->n_buckets : i;		\
+    } else return 0;                                                    \
+  }
+
 #define KHASH_DEFINE(name, khkey_t, khval_t, hash_func, hash_equal)     \
   KHASH_DEFINE2(name, khkey_t, khval_t, 1, hash_func, hash_equal)
 #define KHASH_DEFINE2(name, khkey_t, khval_t, kh_is_map, hash_func, hash_equal) \
@@ -75,21 +350,7 @@
       h->size = h->n_occupied = 0;                                      \
     }                                                                   \
   }                                                                     \
-  int kh_get_##name(pic_state *pic, const kh_##name##_t *h, khkey_t key) \
-  {                                                                     \
-    (void)pic;                                                          \
-    if (h->n_buckets) {                                                 \
-      int k, i, last, mask, step = 0;                                   \
-      mask = h->n_buckets - 1;                                          \
-      k = hash_func(key); i = k & mask;                                 \
-      last = i;                                                         \
-      while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
-        i = (i + (++step)) & mask;                                      \
-        if (i == last) return h->n_buckets;                             \
-      }                                                                 \
-      return ac_iseither(h->flags, i)? h->n_buckets : i;		\
-    } else return 0;                                                    \
-  }                                                                     \
+  KHASH_DEFINE_GET(name, get_##name, khkey_t, hash_func, hash_equal) \
   void kh_resize_##name(pic_state *pic, kh_##name##_t *h, int new_n_buckets) \
   { /* This function uses 0.25*n_buckets bytes of working space instead of [sizeof(key_t+val_t)+.25]*n_buckets. */ \
     int *new_flags = 0;                                                 \
@@ -195,6 +456,8 @@
     }                                                                   \
   }
 
+#endif
+
 /* --- BEGIN OF HASH FUNCTIONS --- */
 
 #define kh_ptr_hash_func(key) (int)(long)(key)
@@ -222,10 +485,17 @@ PIC_INLINE int kh_str_hash_func(const char *s) {
 #define kh_get(name, h, k) kh_get_##name(pic, h, k)
 #define kh_del(name, h, k) kh_del_##name(h, k)
 
-#define kh_exist(h, x) (!ac_iseither((h)->flags, (x)))
-#define kh_key(h, x) ((h)->keys[x])
-#define kh_val(h, x) ((h)->vals[x])
-#define kh_value(h, x) ((h)->vals[x])
+#if PIC_SWISS_TABLE
+# define kh_exist(h, x) ((h)->ctrl[x] >= 0)
+# define kh_key(h, x) ((h)->slots[x].key)
+# define kh_val(h, x) ((h)->slots[x].val)
+# define kh_value(h, x) ((h)->slots[x].val)
+#else
+# define kh_exist(h, x) (!ac_iseither((h)->flags, (x)))
+# define kh_key(h, x) ((h)->keys[x])
+# define kh_val(h, x) ((h)->vals[x])
+# define kh_value(h, x) ((h)->vals[x])
+#endif
 #define kh_begin(h) (0)
 #define kh_end(h) ((h)->n_buckets)
 #define kh_size(h) ((h)->size)
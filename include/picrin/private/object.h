@@ -38,6 +38,7 @@ struct identifier {
 
 struct env {
   OBJECT_HEADER
+  bool cached;                  /* searched by a cached resolution */
   khash_t(env) map;
   struct env *up;
   struct string *lib;
@@ -51,13 +52,18 @@ struct pair {
 
 struct blob {
   OBJECT_HEADER
-  unsigned char *data;
   int len;
+  unsigned char *data;          /* points to storage if len <= PIC_BLOB_INLINE_SIZE */
+  unsigned char storage[1];     /* pointer-aligned so that uvectors can view it */
 };
 
 struct string {
   OBJECT_HEADER
-  struct rope *rope;
+  unsigned char inline_len;     /* length + 1 of an inline string; 0 if u.rope is used */
+  union {
+    struct rope *rope;
+    char buf[PIC_STR_INLINE_SIZE]; /* zero-terminated */
+  } u;
 };
 
 struct dict {
@@ -71,10 +77,67 @@ struct weak {
   struct weak *prev;         /* for GC */
 };
 
+struct bignum {
+  OBJECT_HEADER
+  bool neg;
+  int len;
+  uint32_t digits[1];
+};
+
+enum {
+  PIC_UVEC_F64,
+  PIC_UVEC_F32,
+  PIC_UVEC_S32,
+  PIC_UVEC_U32,
+  PIC_UVEC_S64
+};
+
+struct uvector {
+  OBJECT_HEADER
+  unsigned char kind;
+  int len;
+  struct blob *blob;            /* element storage, shared with bytevector->XXXvector */
+};
+
+enum {
+  PIC_TABLE_EQ,
+  PIC_TABLE_EQV,
+  PIC_TABLE_EQUAL,
+  PIC_TABLE_STRING
+};
+
+struct table_ent {
+  int hash;                     /* 0: empty, 1: deleted */
+  pic_value key, val;
+};
+
+struct table_slots {
+  int capa, used;               /* used counts deleted slots too */
+  struct table_ent *ents;
+};
+
+struct table {
+  OBJECT_HEADER
+  unsigned char kind;
+  bool weak;
+  int size;
+  struct table_slots cur, old;  /* old is being moved into cur */
+  int moved;                    /* slots of old already moved */
+  struct table *prev;           /* for GC */
+};
+
+#if PIC_WORD_BOXING
+struct flonum {
+  OBJECT_HEADER
+  double f;
+};
+#endif
+
 struct vector {
   OBJECT_HEADER
-  pic_value *data;
+  pic_value *data;              /* points to storage if len <= PIC_VEC_INLINE_SIZE */
   int len;
+  pic_value storage[1];
 };
 
 struct data {
@@ -123,6 +186,7 @@ struct error {
 struct port {
   OBJECT_HEADER
   xFILE *file;
+  struct object *owner;         /* keeps borrowed input alive, or NULL */
 };
 
 struct checkpoint {
@@ -149,11 +213,21 @@ struct object *pic_obj_ptr(pic_value);
 #define pic_port_ptr(pic, o) (assert(pic_port_p(pic, o)), (struct port *)pic_obj_ptr(o))
 #define pic_error_ptr(pic, o) (assert(pic_error_p(pic, o)), (struct error *)pic_obj_ptr(o))
 #define pic_rec_ptr(pic, o) (assert(pic_rec_p(pic, o)), (struct record *)pic_obj_ptr(o))
-
-#define pic_obj_p(pic,v) (pic_type(pic,v) > PIC_IVAL_END)
+#define pic_bignum_ptr(pic, o) (assert(pic_bignum_p(pic, o)), (struct bignum *)pic_obj_ptr(o))
+#define pic_uvec_ptr(pic, o) (assert(pic_uvec_p(pic, o)), (struct uvector *)pic_obj_ptr(o))
+#define pic_table_ptr(pic, o) (assert(pic_table_p(pic, o)), (struct table *)pic_obj_ptr(o))
+
+#if PIC_WORD_BOXING
+# define pic_obj_p(pic,v) (((v) & 3) == 0)
+#else
+# define pic_obj_p(pic,v) (pic_type(pic,v) > PIC_IVAL_END)
+#endif
 #define pic_env_p(pic, v) (pic_type(pic, v) == PIC_TYPE_ENV)
 #define pic_error_p(pic, v) (pic_type(pic, v) == PIC_TYPE_ERROR)
 #define pic_rec_p(pic, v) (pic_type(pic, v) == PIC_TYPE_RECORD)
+#define pic_bignum_p(pic, v) (pic_type(pic, v) == PIC_TYPE_BIGNUM)
+#define pic_uvec_p(pic, v) (pic_type(pic, v) == PIC_TYPE_UVECTOR)
+#define pic_table_p(pic, v) (pic_type(pic, v) == PIC_TYPE_TABLE)
 
 pic_value pic_obj_value(void *ptr);
 struct object *pic_obj_alloc(pic_state *, size_t, int type);
@@ -168,6 +242,7 @@ struct object *pic_obj_alloc(pic_state *, size_t, int type);
 #define TYPENAME_id    "identifier"
 #define TYPENAME_env   "environment"
 #define TYPENAME_vec   "vector"
+#define TYPENAME_table "hash-table"
 
 #define TYPE_CHECK(pic, v, type) do {                           \
     if (! pic_##type##_p(pic, v))                               \
@@ -192,12 +267,42 @@ pic_value pic_make_proc(pic_state *, pic_func_t, int, pic_value *);
 pic_value pic_make_proc_irep(pic_state *, struct irep *, struct context *);
 pic_value pic_make_env(pic_state *, pic_value env);
 pic_value pic_make_rec(pic_state *, pic_value type, pic_value datum);
+pic_value pic_adopt_blob(pic_state *, unsigned char *data, int len); /* data from pic_malloc */
 
 pic_value pic_add_identifier(pic_state *, pic_value id, pic_value env);
 void pic_put_identifier(pic_state *, pic_value id, pic_value uid, pic_value env);
 pic_value pic_find_identifier(pic_state *, pic_value id, pic_value env);
 pic_value pic_id_name(pic_state *, pic_value id);
-
+pic_value pic_make_symbol(pic_state *, pic_value str);
+void pic_flush_idcache(pic_state *);
+
+pic_value pic_big_add(pic_state *, pic_value, pic_value);
+pic_value pic_big_sub(pic_state *, pic_value, pic_value);
+pic_value pic_big_mul(pic_state *, pic_value, pic_value);
+pic_value pic_big_div(pic_state *, pic_value, pic_value);
+int pic_big_cmp(pic_state *, pic_value, pic_value);
+double pic_big_to_double(pic_state *, pic_value);
+pic_value pic_big_from_double(pic_state *, double);
+pic_value pic_big_from_int64(pic_state *, int64_t);
+bool pic_big_to_int64(pic_state *, pic_value, int64_t *);
+pic_value pic_big_to_string(pic_state *, pic_value, int radix);
+pic_value pic_big_from_string(pic_state *, const char *, int radix);
+
+const char *pic_uvec_tag(pic_state *, pic_value uvec);
+pic_value pic_uvec_ref(pic_state *, pic_value uvec, int k);
+
+pic_value pic_make_table(pic_state *, int kind, bool weak);
+bool pic_table_has(pic_state *, pic_value table, pic_value key);
+pic_value pic_table_ref(pic_state *, pic_value table, pic_value key);
+void pic_table_set(pic_state *, pic_value table, pic_value key, pic_value val);
+void pic_table_del(pic_state *, pic_value table, pic_value key);
+int pic_table_size(pic_state *, pic_value table);
+void pic_table_clear(pic_state *, pic_value table);
+bool pic_table_next(pic_state *, pic_value table, int *iter, pic_value *key, pic_value *val);
+
+int pic_str_hash_bytes(const char *, int len);
+int pic_utf8_encode(int c, char *buf);
+int pic_utf8_decode(const char *, int len);
 struct rope *pic_rope_incref(struct rope *);
 void pic_rope_decref(pic_state *, struct rope *);
 
@@ -215,6 +320,28 @@ pic_value pic_dynamic_bind(pic_state *, pic_value var, pic_value val, pic_value
 
 pic_value pic_library_environment(pic_state *, const char *);
 
+pic_value pic_compile(pic_state *, pic_value expr);
+
+bool pic_global_p(pic_state *, pic_value uid);
+pic_value pic_global_ref(pic_state *, pic_value uid);
+
+void pic_dump(pic_state *, pic_value obj, xFILE *);
+void pic_dump_unit(pic_state *, pic_value obj, pic_value owned, xFILE *);
+pic_value pic_undump(pic_state *, const unsigned char *buf, size_t len);
+bool pic_restore(pic_state *, const unsigned char *buf, size_t len);
+
+/* compile-time effects recorded by pic_load_compile, see load.c */
+enum {
+  PIC_JOURNAL_PUT,              /* id uid env */
+  PIC_JOURNAL_GLOBAL,           /* uid */
+  PIC_JOURNAL_MACRO,            /* uid macro */
+  PIC_JOURNAL_SHADOW,           /* uid */
+  PIC_JOURNAL_EXPORT,           /* alias name */
+  PIC_JOURNAL_OPAQUE            /* cannot be replayed */
+};
+
+void pic_journal(pic_state *, int kind, pic_value a, pic_value b, pic_value c);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -34,6 +34,13 @@ struct callinfo {
 
 KHASH_DECLARE(oblist, struct string *, struct identifier *)
 KHASH_DECLARE(ltable, const char *, struct lib)
+KHASH_DECLARE(builtin, const char *, pic_func_t)
+
+struct idcache {
+  struct identifier *id, *uid;
+  struct env *env;
+  unsigned epoch;               /* valid if equal to pic->idepoch */
+};
 
 struct pic_state {
   pic_allocf allocf;
@@ -55,9 +62,14 @@ struct pic_state {
   pic_value features;
 
   khash_t(oblist) oblist;       /* string to symbol */
-  int ucnt;
+  struct identifier *sDEFINE, *sDEFINE_MACRO, *sLAMBDA, *sQUOTE, *sBEGIN, *sSETBANG, *sIF;
+  struct identifier *sGREF, *sCREF, *sLREF, *sCALL;
+  pic_value vmprocs;            /* dictionary from inlined primitives to pic_vm_proc index */
   pic_value globals;            /* weak */
   pic_value macros;             /* weak */
+  khash_t(builtin) builtins;    /* procedures of picrin.base bound on first use */
+  bool lazy_defun;              /* pic_defun fills builtins, see proc.c */
+  pic_value journal;            /* #f, a list of effects, or #t if they cannot be replayed */
   khash_t(ltable) ltable;
   struct list_head ireps;
 
@@ -71,6 +83,9 @@ struct pic_state {
   pic_value err;
 
   pic_panicf panicf;
+
+  unsigned idepoch;
+  struct idcache idcache[PIC_IDCACHE_SIZE]; /* resolved identifiers, see lib.c */
 };
 
 #if defined(__cplusplus)
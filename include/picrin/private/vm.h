@@ -69,7 +69,7 @@ struct irep {
   bool varg;
   struct code *code;
   struct irep **irep;
-  int *ints;
+  pic_fixnum_t *ints;
   double *nums;
   struct object **pool;
   size_t ncode, nirep, nints, nnums, npool;
@@ -16,6 +16,14 @@
 # define PIC_USE_WRITE 1
 #endif
 
+#ifndef PIC_USE_MMAP
+# if PIC_USE_STDIO && (defined(__unix__) || defined(__APPLE__))
+#  define PIC_USE_MMAP 1
+# else
+#  define PIC_USE_MMAP 0
+# endif
+#endif
+
 #ifndef PIC_JMPBUF
 # include <setjmp.h>
 # define PIC_JMPBUF jmp_buf
@@ -44,6 +52,10 @@ void abort(void);
 # define PIC_HEAP_PAGE_SIZE (4 * 1024 * 1024)
 #endif
 
+#ifndef PIC_PAIR_PAGE_SIZE
+# define PIC_PAIR_PAGE_SIZE (64 * 1024) /* must be a power of two */
+#endif
+
 #ifndef PIC_PAGE_REQUEST_THRESHOLD
 # define PIC_PAGE_REQUEST_THRESHOLD(total) ((total) * 77 / 100)
 #endif
@@ -76,6 +88,30 @@ void abort(void);
 # define PIC_ISEQ_SIZE 1024
 #endif
 
+#ifndef PIC_VEC_INLINE_SIZE
+# define PIC_VEC_INLINE_SIZE 16
+#endif
+
+#ifndef PIC_BLOB_INLINE_SIZE
+# define PIC_BLOB_INLINE_SIZE 128
+#endif
+
+#ifndef PIC_ROPE_LEAF_SIZE
+# define PIC_ROPE_LEAF_SIZE 128
+#endif
+
+#ifndef PIC_STR_INLINE_SIZE
+# define PIC_STR_INLINE_SIZE 16
+#endif
+
+#ifndef PIC_IDCACHE_SIZE
+# define PIC_IDCACHE_SIZE 256
+#endif
+
+#ifndef PIC_SWISS_TABLE
+# define PIC_SWISS_TABLE 1
+#endif
+
 /* check compatibility */
 
 #if __STDC_VERSION__ >= 199901L
@@ -102,6 +138,7 @@ typedef unsigned int uint32_t;
 typedef long int32_t;
 typedef unsigned long uint32_t;
 # endif
+typedef unsigned long uintptr_t;
 #endif
 
 #if __STDC_VERSION__ >= 201112L
@@ -457,7 +494,13 @@ double PIC_CSTRING_TO_DOUBLE(const char *);
 # define PIC_DIRECT_THREADED_VM 0
 #endif
 
-#if __x86_64__ && (defined(__GNUC__) || defined(__clang__)) && ! defined(__STRICT_ANSI__)
+#ifndef PIC_WORD_BOXING
+# define PIC_WORD_BOXING 0
+#endif
+
+#if PIC_WORD_BOXING
+# define PIC_NAN_BOXING 0
+#elif __x86_64__ && (defined(__GNUC__) || defined(__clang__)) && ! defined(__STRICT_ANSI__)
 # define PIC_NAN_BOXING 1
 #else
 # define PIC_NAN_BOXING 0
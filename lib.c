@@ -16,6 +16,7 @@ pic_make_env(pic_state *pic, pic_value up)
   struct env *env;
 
   env = (struct env *)pic_obj_alloc(pic, sizeof(struct env), PIC_TYPE_ENV);
+  env->cached = false;
   env->up = pic_env_ptr(pic, up);
   env->lib = NULL;
   kh_init(env, &env->map);
@@ -42,6 +43,7 @@ search(pic_state *pic, pic_value id, pic_value env, pic_value *uid)
   struct env *e;
 
   while (1) {
+    pic_env_ptr(pic, env)->cached = true;
     if (search_scope(pic, id, env, uid))
       return true;
     e = pic_env_ptr(pic, env)->up;
@@ -52,8 +54,25 @@ search(pic_state *pic, pic_value id, pic_value env, pic_value *uid)
   return false;
 }
 
-pic_value
-pic_find_identifier(pic_state *pic, pic_value id, pic_value env)
+/* resolutions are cached by (id, env). every scope a cached resolution
+   looked into is flagged, and adding a binding to a flagged scope drops the
+   whole cache. scopes usually get their bindings before anything is looked
+   up through them, so this rarely happens outside of toplevel definitions.
+   the cache is also dropped at each GC since it holds no references. */
+
+#define idcache_index(id, env) ((((uintptr_t)(id) >> 4) ^ ((uintptr_t)(env) >> 4) * 31) & (PIC_IDCACHE_SIZE - 1))
+
+void
+pic_flush_idcache(pic_state *pic)
+{
+  if (++pic->idepoch == 0) {
+    memset(pic->idcache, 0, sizeof pic->idcache);
+    pic->idepoch = 1;
+  }
+}
+
+static pic_value
+find_identifier(pic_state *pic, pic_value id, pic_value env)
 {
   struct env *e;
   pic_value uid;
@@ -74,25 +93,46 @@ pic_find_identifier(pic_state *pic, pic_value id, pic_value env)
   return uid;
 }
 
+pic_value
+pic_find_identifier(pic_state *pic, pic_value id, pic_value env)
+{
+  struct identifier *i = pic_id_ptr(pic, id);
+  struct env *e = pic_env_ptr(pic, env);
+  struct idcache *c = &pic->idcache[idcache_index(i, e)];
+  pic_value uid;
+
+  if (c->epoch == pic->idepoch && c->id == i && c->env == e) {
+    return pic_obj_value(c->uid);
+  }
+
+  uid = find_identifier(pic, id, env);
+
+  c->id = i;
+  c->env = e;
+  c->uid = pic_id_ptr(pic, uid);
+  c->epoch = pic->idepoch;
+
+  return uid;
+}
+
 pic_value
 pic_add_identifier(pic_state *pic, pic_value id, pic_value env)
 {
-  const char *name, *lib;
-  pic_value uid, str;
+  const char *lib;
+  pic_value uid, name;
 
   if (search_scope(pic, id, env, &uid)) {
     return uid;
   }
 
-  name = pic_str(pic, pic_id_name(pic, id));
+  name = pic_id_name(pic, id);
 
   if (pic_env_ptr(pic, env)->up == NULL && pic_sym_p(pic, id)) { /* toplevel & public */
     lib = pic_str(pic, pic_obj_value(pic_env_ptr(pic, env)->lib));
-    str = pic_strf_value(pic, "%s/%s", lib, name);
+    uid = pic_intern(pic, pic_strf_value(pic, "%s/%s", lib, pic_str(pic, name)));
   } else {
-    str = pic_strf_value(pic, ".%s.%d", name, pic->ucnt++);
+    uid = pic_make_symbol(pic, name); /* unique by identity alone */
   }
-  uid = pic_intern(pic, str);
 
   pic_put_identifier(pic, id, uid, env);
 
@@ -104,8 +144,17 @@ pic_put_identifier(pic_state *pic, pic_value id, pic_value uid, pic_value env)
 {
   int it, ret;
 
+  if (pic_env_ptr(pic, env)->cached) {
+    pic_env_ptr(pic, env)->cached = false;
+    pic_flush_idcache(pic);
+  }
+
   it = kh_put(env, &pic_env_ptr(pic, env)->map, pic_id_ptr(pic, id), &ret);
   kh_val(&pic_env_ptr(pic, env)->map, it) = pic_sym_ptr(pic, uid);
+
+  if (pic_env_ptr(pic, env)->up == NULL) {
+    pic_journal(pic, PIC_JOURNAL_PUT, id, uid, env);
+  }
 }
 
 static struct lib *
@@ -139,6 +188,7 @@ make_library_env(pic_state *pic, pic_value name)
   pic_value e;
 
   env = (struct env *)pic_obj_alloc(pic, sizeof(struct env), PIC_TYPE_ENV);
+  env->cached = false;
   env->up = NULL;
   env->lib = pic_str_ptr(pic, name);
   kh_init(env, &env->map);
@@ -164,6 +214,8 @@ pic_make_library(pic_state *pic, const char *lib)
   int it;
   int ret;
 
+  pic_journal(pic, PIC_JOURNAL_OPAQUE, pic_false_value(pic), pic_false_value(pic), pic_false_value(pic));
+
   name = pic_cstr_value(pic, lib);
   env = make_library_env(pic, name);
   exports = pic_make_dict(pic);
@@ -182,6 +234,9 @@ void
 pic_in_library(pic_state *pic, const char *lib)
 {
   get_library(pic, lib);
+  if (pic->lib == NULL || strcmp(pic->lib, lib) != 0) {
+    pic_journal(pic, PIC_JOURNAL_OPAQUE, pic_false_value(pic), pic_false_value(pic), pic_false_value(pic));
+  }
   pic->lib = lib;
 }
 
@@ -215,7 +270,7 @@ pic_import(pic_state *pic, const char *lib)
 
   while (pic_dict_next(pic, pic_obj_value(their->exports), &it, &name, &realname)) {
     uid = pic_find_identifier(pic, realname, pic_obj_value(their->env));
-    if (! pic_weak_has(pic, pic->globals, uid) && ! pic_weak_has(pic, pic->macros, uid)) {
+    if (! pic_global_p(pic, uid) && ! pic_weak_has(pic, pic->macros, uid)) {
       pic_error(pic, "attempted to export undefined variable", 1, realname);
     }
     pic_put_identifier(pic, name, uid, pic_obj_value(our->env));
@@ -226,6 +281,7 @@ void
 pic_export(pic_state *pic, pic_value name)
 {
   pic_dict_set(pic, pic_obj_value(get_library(pic, pic->lib)->exports), name, name);
+  pic_journal(pic, PIC_JOURNAL_EXPORT, name, name, pic_false_value(pic));
 }
 
 static pic_value
@@ -291,7 +347,7 @@ pic_lib_library_import(pic_state *pic)
   }
 
   uid = pic_find_identifier(pic, realname, pic_obj_value(libp->env));
-  if (! pic_weak_has(pic, pic->globals, uid) && ! pic_weak_has(pic, pic->macros, uid)) {
+  if (! pic_global_p(pic, uid) && ! pic_weak_has(pic, pic->macros, uid)) {
     pic_error(pic, "attempted to export undefined variable", 1, realname);
   }
 
@@ -313,6 +369,7 @@ pic_lib_library_export(pic_state *pic)
   }
 
   pic_dict_set(pic, pic_obj_value(get_library(pic, pic->lib)->exports), alias, name);
+  pic_journal(pic, PIC_JOURNAL_EXPORT, alias, name, pic_false_value(pic));
 
   return pic_undef_value(pic);
 }
@@ -2,8 +2,22 @@
  * See Copyright Notice in picrin.h
  */
 
+#if defined(__unix__) || defined(__APPLE__)
+# define _POSIX_C_SOURCE 200112L  /* fdopen */
+#endif
+
 #include "picrin.h"
 #include "picrin/extra.h"
+#include "picrin/private/object.h"
+#include "picrin/private/state.h"
+
+#if PIC_USE_STDIO && (defined(__unix__) || defined(__APPLE__))
+# define PIC_CACHE_WRITE 1
+# include <fcntl.h>
+# include <unistd.h>
+#else
+# define PIC_CACHE_WRITE 0
+#endif
 
 void
 pic_load(pic_state *pic, pic_value port)
@@ -21,7 +35,7 @@ pic_load(pic_state *pic, pic_value port)
 void
 pic_load_cstr(pic_state *pic, const char *str)
 {
-  pic_value e, port = pic_open_port(pic, xfopen_buf(pic, str, strlen(str), "r"));
+  pic_value e, port = pic_open_port(pic, xfopen_mem(pic, str, strlen(str)));
 
   pic_try {
     pic_load(pic, port);
@@ -33,3 +47,404 @@ pic_load_cstr(pic_state *pic, const char *str)
 
   pic_close_port(pic, port);
 }
+
+/* compiled code
+
+   A compiled file is an image (see dump.c) of #(library forms), where each
+   form is the compiled code of a toplevel form paired with what expanding
+   and compiling it did to the state: the identifiers it bound in library
+   environments, the global variables and macros it defined and the names
+   it exported. Loading the file redoes those effects and runs the code one
+   form after another, without reading, expanding or compiling anything.
+   Global variables are referred to by name, so the file can be loaded into
+   any state where the libraries it imports are loaded.
+
+   Anything else done at expansion time, such as making or switching
+   libraries, cannot be replayed; no compiled file is written for a source
+   that does it. */
+
+void
+pic_journal(pic_state *pic, int kind, pic_value a, pic_value b, pic_value c)
+{
+  if (pic_false_p(pic, pic->journal) || pic_true_p(pic, pic->journal)) {
+    return;
+  }
+  if (kind == PIC_JOURNAL_OPAQUE) {
+    pic->journal = pic_true_value(pic);
+    return;
+  }
+  pic_push(pic, pic_list(pic, 4, pic_int_value(pic, kind), a, b, c), pic->journal);
+}
+
+static pic_value
+compile_form(pic_state *pic, pic_value form, const char *lib, pic_value *effects)
+{
+  pic_value code, e;
+
+  pic->journal = pic_nil_value(pic);
+  pic_try {
+    code = pic_compile(pic, pic_expand(pic, form, pic_library_environment(pic, lib)));
+  }
+  pic_catch(e) {
+    pic->journal = pic_false_value(pic);
+    pic_raise(pic, e);
+  }
+  *effects = pic_true_p(pic, pic->journal) ? pic->journal : pic_reverse(pic, pic->journal);
+  pic->journal = pic_false_value(pic);
+  return code;
+}
+
+static void
+run_form(pic_state *pic, pic_value code, const char *lib)
+{
+  pic_value e;
+
+  pic_try {
+    pic_call(pic, code, 0);
+  }
+  pic_catch(e) {
+    pic_in_library(pic, lib);
+    pic_raise(pic, e);
+  }
+  pic_in_library(pic, lib);
+}
+
+/* loads like pic_load and writes the compiled code to file; false if it could not be compiled */
+bool
+pic_load_compile(pic_state *pic, pic_value port, xFILE *file)
+{
+  const char *lib = pic_current_library(pic);
+  pic_value form, code, effects, forms = pic_nil_value(pic), owned, ent, it, e;
+  pic_value outer = pic->journal;
+  bool replayable = true;
+  size_t ai = pic_enter(pic);
+
+  while (! pic_eof_p(pic, form = pic_read(pic, port))) {
+    code = compile_form(pic, form, lib, &effects);
+    if (pic_true_p(pic, effects)) {
+      replayable = false;
+    }
+    if (replayable) {
+      pic_push(pic, pic_cons(pic, effects, code), forms);
+    }
+    run_form(pic, code, lib);
+
+    pic_leave(pic, ai);
+    pic_protect(pic, forms);
+  }
+
+  /* what this did at the expansion time of an outer form is not in its journal */
+  pic->journal = outer;
+  pic_journal(pic, PIC_JOURNAL_OPAQUE, pic_false_value(pic), pic_false_value(pic), pic_false_value(pic));
+
+  if (! replayable) {
+    pic_leave(pic, ai);
+    return false;
+  }
+
+  owned = pic_make_dict(pic);
+  pic_for_each (form, forms, it) {
+    pic_value it2;
+    pic_for_each (ent, pic_car(pic, form), it2) {
+      switch (pic_int(pic, pic_car(pic, ent))) {
+      case PIC_JOURNAL_GLOBAL:
+      case PIC_JOURNAL_MACRO:
+        pic_dict_set(pic, owned, pic_list_ref(pic, ent, 1), pic_true_value(pic));
+        break;
+      }
+    }
+  }
+
+  pic_try {
+    pic_value unit[2];
+    unit[0] = pic_cstr_value(pic, lib);
+    unit[1] = pic_reverse(pic, forms);
+    pic_dump_unit(pic, pic_make_vec(pic, 2, unit), owned, file);
+  }
+  pic_catch(e) {
+    (void)e;
+    pic_leave(pic, ai);
+    return false;
+  }
+  pic_leave(pic, ai);
+  return true;
+}
+
+static bool
+effect_p(pic_state *pic, pic_value ent)
+{
+  pic_value a, b, c;
+
+  if (! pic_list_p(pic, ent) || pic_length(pic, ent) != 4 || ! pic_int_p(pic, pic_car(pic, ent))) {
+    return false;
+  }
+  a = pic_list_ref(pic, ent, 1);
+  b = pic_list_ref(pic, ent, 2);
+  c = pic_list_ref(pic, ent, 3);
+
+  switch (pic_int(pic, pic_car(pic, ent))) {
+  case PIC_JOURNAL_PUT:
+    return pic_id_p(pic, a) && pic_sym_p(pic, b) && pic_env_p(pic, c) && pic_env_ptr(pic, c)->up == NULL;
+  case PIC_JOURNAL_GLOBAL:
+  case PIC_JOURNAL_SHADOW:
+    return pic_sym_p(pic, a);
+  case PIC_JOURNAL_MACRO:
+    return pic_sym_p(pic, a) && pic_proc_p(pic, b);
+  case PIC_JOURNAL_EXPORT:
+    return pic_sym_p(pic, a) && pic_sym_p(pic, b);
+  default:
+    return false;
+  }
+}
+
+static bool
+unit_p(pic_state *pic, pic_value unit, const char *lib)
+{
+  pic_value form, ent, it, it2;
+
+  if (! pic_vec_p(pic, unit) || pic_vec_len(pic, unit) != 2
+      || ! pic_str_p(pic, pic_vec_ref(pic, unit, 0)) || strcmp(pic_str(pic, pic_vec_ref(pic, unit, 0)), lib) != 0
+      || ! pic_list_p(pic, pic_vec_ref(pic, unit, 1))) {
+    return false;
+  }
+  pic_for_each (form, pic_vec_ref(pic, unit, 1), it) {
+    if (! pic_pair_p(pic, form) || ! pic_list_p(pic, pic_car(pic, form)) || ! pic_proc_p(pic, pic_cdr(pic, form))) {
+      return false;
+    }
+    pic_for_each (ent, pic_car(pic, form), it2) {
+      if (! effect_p(pic, ent)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void
+replay(pic_state *pic, pic_value effects)
+{
+  pic_value ent, it, a, b, c;
+
+  pic_for_each (ent, effects, it) {
+    a = pic_list_ref(pic, ent, 1);
+    b = pic_list_ref(pic, ent, 2);
+    c = pic_list_ref(pic, ent, 3);
+
+    switch (pic_int(pic, pic_car(pic, ent))) {
+    case PIC_JOURNAL_PUT:
+      pic_put_identifier(pic, a, b, c);
+      break;
+    case PIC_JOURNAL_GLOBAL:
+      if (! pic_global_p(pic, a)) {
+        pic_weak_set(pic, pic->globals, a, pic_invalid_value(pic));
+      }
+      break;
+    case PIC_JOURNAL_MACRO:
+      pic_weak_set(pic, pic->macros, a, b);
+      break;
+    case PIC_JOURNAL_SHADOW:
+      if (pic_weak_has(pic, pic->macros, a)) {
+        pic_weak_del(pic, pic->macros, a);
+      }
+      break;
+    case PIC_JOURNAL_EXPORT:
+      pic_funcall(pic, "picrin.base", "library-export", 2, b, a);
+      break;
+    }
+  }
+}
+
+/* false if the compiled code cannot be loaded into the current library; nothing has been run then */
+bool
+pic_load_compiled(pic_state *pic, const unsigned char *buf, size_t len)
+{
+  const char *lib = pic_current_library(pic);
+  pic_value unit, form, it, e;
+  size_t ai = pic_enter(pic);
+
+  /* the replayed effects do not go through the journal */
+  pic_journal(pic, PIC_JOURNAL_OPAQUE, pic_false_value(pic), pic_false_value(pic), pic_false_value(pic));
+
+  pic_try {
+    unit = pic_undump(pic, buf, len);
+  }
+  pic_catch(e) {
+    (void)e;
+    pic_leave(pic, ai);
+    return false;
+  }
+  if (! unit_p(pic, unit, lib)) {
+    pic_leave(pic, ai);
+    return false;
+  }
+
+  pic_for_each (form, pic_vec_ref(pic, unit, 1), it) {
+    replay(pic, pic_car(pic, form));
+    run_form(pic, pic_cdr(pic, form), lib);
+  }
+
+  pic_leave(pic, ai);
+  return true;
+}
+
+#if PIC_USE_STDIO
+
+static unsigned char *
+read_file(pic_state *pic, const char *path, size_t *len)
+{
+  FILE *fp;
+  unsigned char *buf = NULL;
+  long size;
+
+  if ((fp = fopen(path, "rb")) == NULL) {
+    return NULL;
+  }
+  if (fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) > 0 && fseek(fp, 0, SEEK_SET) == 0) {
+    buf = pic_malloc(pic, size);
+    if (fread(buf, 1, size, fp) != (size_t)size) {
+      pic_free(pic, buf);
+      buf = NULL;
+    }
+    *len = size;
+  }
+  fclose(fp);
+  return buf;
+}
+
+static pic_value
+cache_path(pic_state *pic, const char *src, int len, const char *dir)
+{
+  static const char digits[] = "0123456789abcdef";
+  const char *lib = pic_current_library(pic);
+  uint64_t h = UINT64_C(14695981039346656037); /* FNV-1a */
+  char hex[17];
+  int i;
+
+  for (i = 0; lib[i] != '\0'; ++i) {
+    h = (h ^ (unsigned char)lib[i]) * UINT64_C(1099511628211);
+  }
+  h *= UINT64_C(1099511628211);          /* the terminating nul */
+  for (i = 0; i < len; ++i) {
+    h = (h ^ (unsigned char)src[i]) * UINT64_C(1099511628211);
+  }
+  for (i = 0; i < 16; ++i) {
+    hex[i] = digits[(h >> (60 - i * 4)) & 0xf];
+  }
+  hex[16] = '\0';
+
+  return pic_strf_value(pic, "%s/%s.pic", dir, hex);
+}
+
+/* creates a temporary file next to path that no other writer shares, or
+   returns NULL. without exclusive creation the cache is not written */
+static FILE *
+open_cache_tmp(pic_state *pic, pic_value path, pic_value *tmp)
+{
+#if PIC_CACHE_WRITE
+  FILE *fp;
+  int fd;
+
+  *tmp = pic_strf_value(pic, "%s.%d.tmp", pic_str(pic, path), (int)getpid());
+  if ((fd = open(pic_str(pic, *tmp), O_WRONLY | O_CREAT | O_EXCL, 0666)) < 0) {
+    return NULL;
+  }
+  if ((fp = fdopen(fd, "wb")) == NULL) {
+    close(fd);
+    remove(pic_str(pic, *tmp));
+  }
+  return fp;
+#else
+  (void)pic;
+  (void)path;
+  (void)tmp;
+  return NULL;
+#endif
+}
+
+/* loads buf, a compiled file read into memory, and frees it; false as for
+   pic_load_compiled */
+static bool
+load_cache_file(pic_state *pic, unsigned char *buf, size_t size)
+{
+  pic_value e;
+  bool ok;
+
+  pic_try {
+    ok = pic_load_compiled(pic, buf, size);
+  }
+  pic_catch(e) {
+    pic_free(pic, buf);
+    pic_raise(pic, e);
+  }
+  pic_free(pic, buf);
+  return ok;
+}
+
+/* loads src while compiling it into file, which is written to tmp and
+   renamed to path once complete */
+static void
+compile_cached(pic_state *pic, const char *src, int len, xFILE *file, pic_value tmp, pic_value path)
+{
+  pic_value port, e;
+  bool ok;
+
+  port = pic_open_port(pic, xfopen_mem(pic, src, len));
+
+  pic_try {
+    ok = pic_load_compile(pic, port, file);
+  }
+  pic_catch(e) {
+    pic_close_port(pic, port);
+    xfclose(pic, file);
+    remove(pic_str(pic, tmp));
+    pic_raise(pic, e);
+  }
+  pic_close_port(pic, port);
+
+  xfflush(pic, file);
+  ok = ok && ! xferror(pic, file);
+  if (xfclose(pic, file) != 0 || ! ok || rename(pic_str(pic, tmp), pic_str(pic, path)) != 0) {
+    remove(pic_str(pic, tmp));
+  }
+}
+
+/* loads src, through a compiled file in dir named after the hash of the
+   source and the current library. the file is written when missing */
+void
+pic_load_cached(pic_state *pic, const char *src, int len, const char *dir)
+{
+  pic_value path, tmp, port, e;
+  unsigned char *buf;
+  size_t size;
+  xFILE *file = NULL;
+  FILE *fp;
+
+  if (dir != NULL) {
+    path = cache_path(pic, src, len, dir);
+    if ((buf = read_file(pic, pic_str(pic, path), &size)) != NULL && load_cache_file(pic, buf, size)) {
+      return;
+    }
+
+    if ((fp = open_cache_tmp(pic, path, &tmp)) != NULL && (file = xfopen_file(pic, fp, "w")) == NULL) {
+      fclose(fp);
+      remove(pic_str(pic, tmp));
+    }
+    if (file != NULL) {
+      compile_cached(pic, src, len, file, tmp, path);
+      return;
+    }
+  }
+
+  port = pic_open_port(pic, xfopen_mem(pic, src, len));
+
+  pic_try {
+    pic_load(pic, port);
+  }
+  pic_catch(e) {
+    pic_close_port(pic, port);
+    pic_raise(pic, e);
+  }
+  pic_close_port(pic, port);
+}
+
+#endif
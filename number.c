@@ -4,6 +4,22 @@
 
 #include "picrin.h"
 #include "picrin/extra.h"
+#include "picrin/private/object.h"
+
+#define pic_exact_p(pic, v) (pic_int_p(pic, v) || pic_bignum_p(pic, v))
+#define pic_number_p(pic, v) (pic_float_p(pic, v) || pic_exact_p(pic, v))
+
+static double
+number_to_double(pic_state *pic, pic_value v)
+{
+  if (pic_float_p(pic, v)) {
+    return pic_float(pic, v);
+  } else if (pic_int_p(pic, v)) {
+    return pic_fixnum(pic, v);
+  } else {
+    return pic_big_to_double(pic, v);
+  }
+}
 
 static pic_value
 pic_number_number_p(pic_state *pic)
@@ -12,7 +28,7 @@ pic_number_number_p(pic_state *pic)
 
   pic_get_args(pic, "o", &v);
 
-  return pic_bool_value(pic, pic_float_p(pic, v) || pic_int_p(pic, v));
+  return pic_bool_value(pic, pic_number_p(pic, v));
 }
 
 static pic_value
@@ -22,7 +38,7 @@ pic_number_exact_p(pic_state *pic)
 
   pic_get_args(pic, "o", &v);
 
-  return pic_bool_value(pic, pic_int_p(pic, v));
+  return pic_bool_value(pic, pic_exact_p(pic, v));
 }
 
 static pic_value
@@ -52,48 +68,102 @@ pic_number_exact(pic_state *pic)
 
   pic_get_args(pic, "f", &f);
 
-  return pic_int_value(pic, (int)f);
+  if (PIC_FIXNUM_MIN <= f && f < -(double)PIC_FIXNUM_MIN) {
+    return pic_fixnum_value(pic, (pic_fixnum_t)f);
+  }
+  if (f != f || f - f != 0) {
+    pic_error(pic, "exact: finite number required", 1, pic_float_value(pic, f));
+  }
+  return pic_big_from_double(pic, f);
+}
+
+/* fixnum operations; each returns false when the result is not a fixnum */
+
+static bool
+fixnum_add(pic_fixnum_t a, pic_fixnum_t b, pic_fixnum_t *r)
+{
+  if (b > 0 ? a > PIC_FIXNUM_MAX - b : a < PIC_FIXNUM_MIN - b) {
+    return false;
+  }
+  *r = a + b;
+  return true;
+}
+
+static bool
+fixnum_sub(pic_fixnum_t a, pic_fixnum_t b, pic_fixnum_t *r)
+{
+  if (b < 0 ? a > PIC_FIXNUM_MAX + b : a < PIC_FIXNUM_MIN + b) {
+    return false;
+  }
+  *r = a - b;
+  return true;
+}
+
+static bool
+fixnum_mul(pic_fixnum_t a, pic_fixnum_t b, pic_fixnum_t *r)
+{
+  if (a > 0) {
+    if (b > 0 ? a > PIC_FIXNUM_MAX / b : b < PIC_FIXNUM_MIN / a) {
+      return false;
+    }
+  } else if (a < 0) {
+    if (b > 0 ? a < PIC_FIXNUM_MIN / b : b < PIC_FIXNUM_MAX / a) {
+      return false;
+    }
+  }
+  *r = a * b;
+  return true;
+}
+
+static bool
+fixnum_div(pic_fixnum_t a, pic_fixnum_t b, pic_fixnum_t *r)
+{
+  if (b == 0 || (a == PIC_FIXNUM_MIN && b == -1) || a % b != 0) {
+    return false;
+  }
+  *r = a / b;
+  return true;
 }
 
-#define pic_define_aop(name, op, guard)                                 \
+#define pic_define_aop(name, op, iop, bop)                              \
   pic_value                                                             \
   name(pic_state *pic, pic_value a, pic_value b)                        \
   {                                                                     \
-    double f;                                                           \
+    pic_fixnum_t r;                                                     \
     if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
-      f = (double)pic_int(pic, a) op (double)pic_int(pic, b);           \
-      return (INT_MIN <= f && f <= INT_MAX && guard)                    \
-        ? pic_int_value(pic, (int)f)                                    \
-        : pic_float_value(pic, f);                                      \
+      if (iop(pic_fixnum(pic, a), pic_fixnum(pic, b), &r)) {            \
+        return pic_fixnum_value(pic, r);                                \
+      }                                                                 \
+      return bop(pic, a, b);                                            \
     } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
       return pic_float_value(pic, pic_float(pic, a) op pic_float(pic, b)); \
-    } else if (pic_int_p(pic, a) && pic_float_p(pic, b)) {              \
-      return pic_float_value(pic, pic_int(pic, a) op pic_float(pic, b)); \
-    } else if (pic_float_p(pic, a) && pic_int_p(pic, b)) {              \
-      return pic_float_value(pic, pic_float(pic, a) op pic_int(pic, b)); \
+    } else if (pic_exact_p(pic, a) && pic_exact_p(pic, b)) {            \
+      return bop(pic, a, b);                                            \
+    } else if (pic_number_p(pic, a) && pic_number_p(pic, b)) {          \
+      return pic_float_value(pic, number_to_double(pic, a) op number_to_double(pic, b)); \
     } else {                                                            \
       pic_error(pic, #name ": non-number operand given", 0);              \
     }                                                                   \
     PIC_UNREACHABLE();                                                  \
   }
 
-pic_define_aop(pic_add, +, true)
-pic_define_aop(pic_sub, -, true)
-pic_define_aop(pic_mul, *, true)
-pic_define_aop(pic_div, /, f == (int)f)
+pic_define_aop(pic_add, +, fixnum_add, pic_big_add)
+pic_define_aop(pic_sub, -, fixnum_sub, pic_big_sub)
+pic_define_aop(pic_mul, *, fixnum_mul, pic_big_mul)
+pic_define_aop(pic_div, /, fixnum_div, pic_big_div)
 
 #define pic_define_cmp(name, op)                                        \
   bool                                                                  \
   name(pic_state *pic, pic_value a, pic_value b)                        \
   {                                                                     \
     if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
-      return pic_int(pic, a) op pic_int(pic, b);                        \
+      return pic_fixnum(pic, a) op pic_fixnum(pic, b);                  \
     } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
       return pic_float(pic, a) op pic_float(pic, b);                    \
-    } else if (pic_int_p(pic, a) && pic_float_p(pic, b)) {              \
-      return pic_int(pic, a) op pic_float(pic, b);                      \
-    } else if (pic_float_p(pic, a) && pic_int_p(pic, b)) {              \
-      return pic_float(pic, a) op pic_int(pic, b);                      \
+    } else if (pic_exact_p(pic, a) && pic_exact_p(pic, b)) {            \
+      return pic_big_cmp(pic, a, b) op 0;                               \
+    } else if (pic_number_p(pic, a) && pic_number_p(pic, b)) {          \
+      return number_to_double(pic, a) op number_to_double(pic, b);      \
     } else {                                                            \
       pic_error(pic, #name ": non-number operand given", 0);              \
     }                                                                   \
@@ -169,16 +239,22 @@ DEFINE_AOP(div, pic_div(pic, pic_int_value(pic, 1), argv[0]), do {
     pic_error(pic, "/: at least one argument required", 0);
   } while (0))
 
+#if PIC_WORD_BOXING
+typedef uint64_t ufixnum_t;
+#else
+typedef unsigned long ufixnum_t;
+#endif
+
 static int
-number_string_length(int val, int radix)
+number_string_length(pic_fixnum_t val, int radix)
 {
-  unsigned long v = val; /* in case val == INT_MIN */
+  ufixnum_t v = val;
   int count = 0;
   if (val == 0) {
     return 1;
   }
   if (val < 0) {
-    v = -val;
+    v = -v;                     /* in case val == PIC_FIXNUM_MIN */
     count = 1;
   }
   while (v > 0) {
@@ -189,9 +265,9 @@ number_string_length(int val, int radix)
 }
 
 static void
-number_string(int val, int radix, int length, char *buffer) {
+number_string(pic_fixnum_t val, int radix, int length, char *buffer) {
   const char digits[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
-  unsigned long v = val;
+  ufixnum_t v = val;
   int i;
   if (val == 0) {
     buffer[0] = '0';
@@ -200,7 +276,7 @@ number_string(int val, int radix, int length, char *buffer) {
   }
   if (val < 0) {
     buffer[0] = '-';
-    v = -val;
+    v = -v;
   }
 
   for(i = length - 1; v > 0; --i) {
@@ -214,19 +290,24 @@ number_string(int val, int radix, int length, char *buffer) {
 static pic_value
 pic_number_number_to_string(pic_state *pic)
 {
-  double f;
-  bool e;
+  pic_value n;
   int radix = 10;
   pic_value str;
 
-  pic_get_args(pic, "F|i", &f, &e, &radix);
+  pic_get_args(pic, "o|i", &n, &radix);
 
+  if (! pic_number_p(pic, n)) {
+    pic_error(pic, "number->string: number required", 1, n);
+  }
   if (radix < 2 || radix > 36) {
     pic_error(pic, "number->string: invalid radix (between 2 and 36, inclusive)", 1, pic_int_value(pic, radix));
   }
 
-  if (e) {
-    int ival = (int) f;
+  if (pic_bignum_p(pic, n)) {
+    str = pic_big_to_string(pic, n, radix);
+  }
+  else if (pic_int_p(pic, n)) {
+    pic_fixnum_t ival = pic_fixnum(pic, n);
     int ilen = number_string_length(ival, radix);
     char *buf = pic_alloca(pic, ilen + 1);
 
@@ -235,13 +316,10 @@ pic_number_number_to_string(pic_state *pic)
     str = pic_str_value(pic, buf, ilen);
   }
   else {
-    xFILE *file = xfopen_buf(pic, NULL, 0, "w");
-    const char *buf;
-    int len;
+    xFILE *file = xfopen_str(pic);
 
-    xfprintf(pic, file, "%f", f);
-    xfget_buf(pic, file, &buf, &len);
-    str = pic_str_value(pic, buf, len);
+    xfprintf(pic, file, "%f", pic_float(pic, n));
+    xfget_str(pic, file, &str);
     xfclose(pic, file);
   }
 
@@ -297,8 +375,8 @@ string_to_number(pic_state *pic, const char *str)
 
   flt = PIC_CSTRING_TO_DOUBLE(str);
 
-  if (isint && INT_MIN <= flt && flt <= INT_MAX) {
-    return pic_int_value(pic, flt);
+  if (isint && PIC_FIXNUM_MIN <= flt && flt < -(double)PIC_FIXNUM_MIN) {
+    return pic_fixnum_value(pic, flt);
   } else {
     return pic_float_value(pic, flt);
   }
@@ -309,8 +387,7 @@ pic_number_string_to_number(pic_state *pic)
 {
   const char *str;
   int radix = 10;
-  long num;
-  char *eptr;
+  pic_value num;
 
   pic_get_args(pic, "z|i", &str, &radix);
 
@@ -323,9 +400,13 @@ pic_number_string_to_number(pic_state *pic)
   if (strcaseeq(str, "-nan.0"))
     return pic_float_value(pic, -0.0 / 0.0);
 
-  num = strtol(str, &eptr, radix);
-  if (*eptr == '\0') {
-    return INT_MIN <= num && num <= INT_MAX ? pic_int_value(pic, num) : pic_float_value(pic, num);
+  if (radix < 2 || radix > 36) {
+    pic_error(pic, "string->number: invalid radix (between 2 and 36, inclusive)", 1, pic_int_value(pic, radix));
+  }
+
+  num = pic_big_from_string(pic, str, radix);
+  if (! pic_false_p(pic, num)) {
+    return num;
   }
 
   return string_to_number(pic, str);
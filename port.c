@@ -17,6 +17,7 @@ pic_open_port(pic_state *pic, xFILE *file)
 
   port = (struct port *)pic_obj_alloc(pic, sizeof(struct port), PIC_TYPE_PORT);
   port->file = file;
+  port->owner = NULL;
 
   return pic_obj_value(port);
 }
@@ -136,12 +137,19 @@ pic_port_close_port(pic_state *pic)
 static pic_value
 pic_port_open_input_bytevector(pic_state *pic)
 {
+  pic_value blob, port;
   unsigned char *buf;
   int len;
 
-  pic_get_args(pic, "b", &buf, &len);
+  pic_get_args(pic, "o", &blob);
 
-  return pic_open_port(pic, xfopen_buf(pic, (char *)buf, len, "r"));
+  TYPE_CHECK(pic, blob, blob);
+
+  /* read the bytevector in place; the port keeps it alive */
+  buf = pic_blob(pic, blob, &len);
+  port = pic_open_port(pic, xfopen_mem(pic, (char *)buf, len));
+  pic_port_ptr(pic, port)->owner = pic_obj_ptr(blob);
+  return port;
 }
 
 static pic_value
@@ -169,6 +177,65 @@ pic_port_get_output_bytevector(pic_state *pic)
   return pic_blob_value(pic, (unsigned char *)buf, len);
 }
 
+static pic_value
+pic_port_get_output_bytevector_ip(pic_state *pic)
+{
+  pic_value port = pic_stdout(pic);
+  char *buf;
+  int len;
+
+  pic_get_args(pic, "|p", &port);
+
+  assert_port_profile(port, X_WRITE, "get-output-bytevector!");
+
+  /* hand the buffer over and start the port afresh */
+  if (xftake_buf(pic, pic_fileno(pic, port), &buf, &len) < 0) {
+    pic_error(pic, "port was not created by open-output-bytevector", 0);
+  }
+  return pic_adopt_blob(pic, (unsigned char *)buf, len);
+}
+
+static pic_value
+pic_port_open_output_string(pic_state *pic)
+{
+  pic_get_args(pic, "");
+
+  return pic_open_port(pic, xfopen_str(pic));
+}
+
+static pic_value
+pic_port_get_output_string(pic_state *pic)
+{
+  pic_value port = pic_stdout(pic), str;
+
+  pic_get_args(pic, "|p", &port);
+
+  assert_port_profile(port, X_WRITE, "get-output-string");
+
+  if (xfget_str(pic, pic_fileno(pic, port), &str) < 0) {
+    pic_error(pic, "port was not created by open-output-string", 0);
+  }
+  return str;
+}
+
+#if PIC_USE_MMAP
+
+static pic_value
+pic_port_open_input_file_mmap(pic_state *pic)
+{
+  const char *path;
+  xFILE *file;
+
+  pic_get_args(pic, "z", &path);
+
+  if ((file = xfopen_mmap(pic, path)) == NULL) {
+    pic_error(pic, "open-input-file/mmap: could not map file", 1, pic_cstr_value(pic, path));
+  }
+  return pic_open_port(pic, file);
+}
+
+#endif
+
 static pic_value
 pic_port_read_u8(pic_state *pic){
   pic_value port = pic_stdin(pic);
@@ -219,7 +286,7 @@ pic_port_u8_ready_p(pic_state *pic)
 static pic_value
 pic_port_read_bytevector(pic_state *pic)
 {
-  pic_value port = pic_stdin(pic);
+  pic_value port = pic_stdin(pic), blob;
   unsigned char *buf;
   int k, i;
 
@@ -227,12 +294,16 @@ pic_port_read_bytevector(pic_state *pic)
 
   assert_port_profile(port, X_READ, "read-bytevector");
 
-  buf = pic_blob(pic, pic_blob_value(pic, NULL, k), NULL);
+  blob = pic_blob_value(pic, NULL, k);
+  buf = pic_blob(pic, blob, NULL);
 
   i = xfread(pic, buf, sizeof(char), k, pic_fileno(pic, port));
   if (i == 0) {
     return pic_eof_object(pic);
   }
+  if (i == k) {
+    return blob;
+  }
   return pic_blob_value(pic, buf, i);
 }
 
@@ -283,7 +354,7 @@ pic_port_write_bytevector(pic_state *pic)
 {
   pic_value port;
   unsigned char *buf;
-  int n, start, end, len, done;
+  int n, start, end, len;
 
   n = pic_get_args(pic, "b|pii", &buf, &len, &port, &start, &end);
 
@@ -299,10 +370,41 @@ pic_port_write_bytevector(pic_state *pic)
   VALID_RANGE(pic, len, start, end);
   assert_port_profile(port, X_WRITE, "write-bytevector");
 
-  done = 0;
-  while (done < end - start) {
-    done += xfwrite(pic, buf + start + done, 1, end - start - done, pic_fileno(pic, port));
-    /* FIXME: error check... */
+  if (xfwrite(pic, buf + start, 1, end - start, pic_fileno(pic, port)) < (size_t)(end - start)) {
+    pic_error(pic, "write-bytevector: failure", 0);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_port_write_string(pic_state *pic)
+{
+  pic_value port, str;
+  int n, start, end, len;
+  size_t size;
+
+  n = pic_get_args(pic, "s|pii", &str, &port, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 1:
+    port = pic_stdout(pic);
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+  assert_port_profile(port, X_WRITE, "write-string");
+
+  if (start != 0 || end != len) {
+    str = pic_str_sub(pic, str, start, end);
+  }
+  size = pic_str_nbytes(pic, str);
+  if (xfwrite(pic, pic_str(pic, str), 1, size, pic_fileno(pic, port)) < size) {
+    pic_error(pic, "write-string: failure", 0);
   }
   return pic_undef_value(pic);
 }
@@ -361,10 +463,17 @@ pic_init_port(pic_state *pic)
   /* output */
   pic_defun(pic, "write-u8", pic_port_write_u8);
   pic_defun(pic, "write-bytevector", pic_port_write_bytevector);
+  pic_defun(pic, "write-string", pic_port_write_string);
   pic_defun(pic, "flush-output-port", pic_port_flush);
 
   /* string I/O */
   pic_defun(pic, "open-input-bytevector", pic_port_open_input_bytevector);
   pic_defun(pic, "open-output-bytevector", pic_port_open_output_bytevector);
   pic_defun(pic, "get-output-bytevector", pic_port_get_output_bytevector);
+  pic_defun(pic, "get-output-bytevector!", pic_port_get_output_bytevector_ip);
+  pic_defun(pic, "open-output-string", pic_port_open_output_string);
+  pic_defun(pic, "get-output-string", pic_port_get_output_string);
+#if PIC_USE_MMAP
+  pic_defun(pic, "open-input-file/mmap", pic_port_open_input_file_mmap);
+#endif
 }
@@ -22,6 +22,17 @@ arg_error(pic_state *pic, int actual, bool varg, int expected)
 
 #define GET_OPERAND(pic,n) ((pic)->ci->fp[(n)])
 
+static char
+char_byte(pic_state *pic, pic_value v)
+{
+  int c = pic_char(pic, v);
+
+  if (c > 0xff) {
+    pic_error(pic, "pic_get_args: char out of range", 1, v);
+  }
+  return (char)c;
+}
+
 /**
  * char type                    desc.
  * ---- ----                    ----
@@ -30,7 +41,8 @@ arg_error(pic_state *pic, int actual, bool varg, int expected)
  *  I   int *, bool *           int with exactness
  *  f   double *                float
  *  F   double *, bool *        float with exactness
- *  c   char *                  char
+ *  c   char *                  char in the range 0-255
+ *  C   int *                   char as a code point
  *  z   char **                 c string
  *  b   unsigned char *, int *  bytevector
  *  u   void **, const pic_data_type *  user data type
@@ -172,7 +184,17 @@ pic_get_args(pic_state *pic, const char *format, ...)
           *e = false;                                                   \
           break;                                                        \
         case PIC_TYPE_INT:                                              \
-          *n = pic_int(pic, v);                                         \
+          if (c1 == 'i' && ! FIXNUM_INT_P(pic_fixnum(pic, v))) {        \
+            pic_error(pic, "pic_get_args: integer out of range", 1, v); \
+          }                                                             \
+          *n = pic_fixnum(pic, v);                                      \
+          *e = true;                                                    \
+          break;                                                        \
+        case PIC_TYPE_BIGNUM:                                           \
+          if (c1 != 'f') {                                              \
+            pic_error(pic, "pic_get_args: integer out of range", 1, v); \
+          }                                                             \
+          *n = pic_big_to_double(pic, v);                               \
           *e = true;                                                    \
           break;                                                        \
         default:                                                        \
@@ -181,6 +203,12 @@ pic_get_args(pic_state *pic, const char *format, ...)
         break;                                                          \
       }
 
+#if PIC_WORD_BOXING
+# define FIXNUM_INT_P(n) (INT_MIN <= (n) && (n) <= INT_MAX)
+#else
+# define FIXNUM_INT_P(n) true
+#endif
+
     NUM_CASE('i', 'I', int)
     NUM_CASE('f', 'F', double)
 
@@ -200,7 +228,8 @@ pic_get_args(pic_state *pic, const char *format, ...)
         break;                                                          \
       }
 
-    VAL_CASE('c', char, char, pic_char(pic, v))
+    VAL_CASE('C', char, int, pic_char(pic, v))
+    VAL_CASE('c', char, char, char_byte(pic, v))
     VAL_CASE('z', str, const char *, pic_str(pic, v))
 
 #define OBJ_CASE(c, type) VAL_CASE(c, type, pic_value, v)
@@ -239,12 +268,54 @@ pic_get_args(pic_state *pic, const char *format, ...)
   return argc;
 }
 
+/* built-in procedures
+
+   The procedures pic_init_core defines in C are not bound when the state is
+   made. pic_defun only records them by name, and a global variable of
+   picrin.base that is looked up and found missing is bound to a new
+   procedure from that table. Their names are exported as usual. */
+
+KHASH_DEFINE(builtin, const char *, pic_func_t, kh_str_hash_func, kh_str_cmp_func)
+
+#define BUILTIN_PREFIX "picrin.base/"
+
+static int
+find_builtin(pic_state *pic, pic_value uid)
+{
+  const char *name = pic_sym(pic, uid);
+
+  if (strncmp(name, BUILTIN_PREFIX, sizeof BUILTIN_PREFIX - 1) != 0) {
+    return kh_end(&pic->builtins);
+  }
+  return kh_get(builtin, &pic->builtins, name + sizeof BUILTIN_PREFIX - 1);
+}
+
+static bool
+bind_builtin(pic_state *pic, pic_value uid)
+{
+  int it = find_builtin(pic, uid);
+
+  if (it == kh_end(&pic->builtins)) {
+    return false;
+  }
+  /* the entry stays, as the binding goes away with the uid if that is collected */
+  pic_weak_set(pic, pic->globals, uid, pic_make_proc(pic, kh_val(&pic->builtins, it), 0, NULL));
+  return true;
+}
+
+/* whether uid is a global variable, bound or not yet */
+bool
+pic_global_p(pic_state *pic, pic_value uid)
+{
+  return pic_weak_has(pic, pic->globals, uid) || find_builtin(pic, uid) != kh_end(&pic->builtins);
+}
+
 static pic_value
 vm_gref(pic_state *pic, pic_value uid)
 {
   pic_value val;
 
-  if (! pic_weak_has(pic, pic->globals, uid)) {
+  if (! pic_weak_has(pic, pic->globals, uid) && ! bind_builtin(pic, uid)) {
     pic_error(pic, "undefined variable", 1, uid);
   }
   val = pic_weak_ref(pic, pic->globals, uid);;
@@ -257,7 +328,7 @@ vm_gref(pic_state *pic, pic_value uid)
 static void
 vm_gset(pic_state *pic, pic_value uid, pic_value value)
 {
-  if (! pic_weak_has(pic, pic->globals, uid)) {
+  if (! pic_global_p(pic, uid)) {
     pic_error(pic, "undefined variable", 1, uid);
   }
   pic_weak_set(pic, pic->globals, uid, value);
@@ -395,7 +466,7 @@ pic_apply(pic_state *pic, pic_value proc, int argc, pic_value *argv)
       NEXT;
     }
     CASE(OP_PUSHINT) {
-      PUSH(pic_int_value(pic, pic->ci->irep->ints[c.a]));
+      PUSH(pic_fixnum_value(pic, pic->ci->irep->ints[c.a]));
       NEXT;
     }
     CASE(OP_PUSHFLOAT) {
@@ -822,7 +893,14 @@ pic_vlambda(pic_state *pic, pic_func_t f, int n, va_list ap)
 void
 pic_defun(pic_state *pic, const char *name, pic_func_t f)
 {
-  pic_define(pic, pic_current_library(pic), name, pic_make_proc(pic, f, 0, NULL));
+  int it, ret;
+
+  if (pic->lazy_defun) {
+    it = kh_put(builtin, &pic->builtins, name, &ret);
+    kh_val(&pic->builtins, it) = f;
+  } else {
+    pic_define(pic, pic_current_library(pic), name, pic_make_proc(pic, f, 0, NULL));
+  }
   pic_export(pic, pic_intern_cstr(pic, name));
 }
 
@@ -843,7 +921,7 @@ pic_define(pic_state *pic, const char *lib, const char *name, pic_value val)
   env = pic_library_environment(pic, lib);
 
   uid = pic_find_identifier(pic, sym, env);
-  if (pic_weak_has(pic, pic->globals, uid)) {
+  if (pic_global_p(pic, uid)) {
     pic_warnf(pic, "redefining variable: %s", pic_sym(pic, uid));
   }
   pic_weak_set(pic, pic->globals, uid, val);
@@ -861,6 +939,12 @@ pic_ref(pic_state *pic, const char *lib, const char *name)
   return vm_gref(pic, pic_find_identifier(pic, sym, env));
 }
 
+pic_value
+pic_global_ref(pic_state *pic, pic_value uid)
+{
+  return vm_gref(pic, uid);
+}
+
 void
 pic_set(pic_state *pic, const char *lib, const char *name, pic_value val)
 {
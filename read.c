@@ -5,16 +5,14 @@
 #include "picrin.h"
 #include "picrin/extra.h"
 #include "picrin/private/object.h"
+#include "picrin/private/file.h"
 
 #undef EOF
 #define EOF (-1)
 
-KHASH_DECLARE(read, int, pic_value)
-KHASH_DEFINE(read, int, pic_value, kh_int_hash_func, kh_int_hash_equal)
-
 struct reader_control {
   int typecase;
-  khash_t(read) labels;
+  pic_value labels;             /* made on the first datum label */
 };
 
 #define CASE_DEFAULT 0
@@ -25,6 +23,16 @@ typedef pic_value (*pic_reader_t)(pic_state *, xFILE *file, int c, struct reader
 static pic_reader_t reader_table[256];
 static pic_reader_t reader_dispatch[256];
 
+enum {
+  C_SPACE = 1,
+  C_DELIM = 2,
+  C_DIGIT = 4
+};
+
+static unsigned char char_class[256];
+
+#define char_p(c, cls) ((c) != EOF && (char_class[(c)] & (cls)))
+
 static pic_value read(pic_state *pic, xFILE *file, int c, struct reader_control *p);
 static pic_value read_nullable(pic_state *pic, xFILE *file, int c, struct reader_control *p);
 
@@ -34,18 +42,16 @@ read_error(pic_state *pic, const char *msg, pic_value irritants)
   pic_raise(pic, pic_make_error(pic, "read", msg, irritants));
 }
 
-static int
-skip(pic_state *pic, xFILE *file, int c)
-{
-  while (isspace(c)) {
-    c = xfgetc(pic, file);
-  }
-  return c;
-}
+/* the reader works on the port's buffer directly and only calls into the
+   port when the buffer runs dry */
 
 static int
 next(pic_state *pic, xFILE *file)
 {
+  if (file->cnt > 0) {
+    file->cnt--;
+    return (unsigned char) *file->ptr++;
+  }
   return xfgetc(pic, file);
 }
 
@@ -54,11 +60,23 @@ peek(pic_state *pic, xFILE *file)
 {
   int c;
 
+  if (file->cnt > 0) {
+    return (unsigned char) *file->ptr;
+  }
   xungetc(pic, (c = xfgetc(pic, file)), file);
 
   return c;
 }
 
+static int
+skip(pic_state *pic, xFILE *file, int c)
+{
+  while (char_p(c, C_SPACE)) {
+    c = next(pic, file);
+  }
+  return c;
+}
+
 static bool
 expect(pic_state *pic, xFILE *file, const char *str)
 {
@@ -76,7 +94,17 @@ expect(pic_state *pic, xFILE *file, const char *str)
 static bool
 isdelim(int c)
 {
-  return c == EOF || strchr("();,|\" \t\n\r", c) != NULL; /* ignores "#", "'" */
+  return c == EOF || (char_class[c] & C_DELIM);
+}
+
+static int
+hexdigit(int c)
+{
+  if (char_p(c, C_DIGIT)) {
+    return c - '0';
+  }
+  c = tolower(c);
+  return 'a' <= c && c <= 'f' ? c - 'a' + 10 : -1;
 }
 
 static int
@@ -201,41 +229,178 @@ read_syntax_unquote(pic_state *pic, xFILE *file, int PIC_UNUSED(c), struct reade
   return pic_list(pic, 2, tag, read(pic, file, next(pic, file), p));
 }
 
-static pic_value
-read_atom(pic_state *pic, xFILE *file, int c, struct reader_control *p) {
-  int len;
-  char *buf;
-  pic_value str;
+/* atoms are gathered into a small inline buffer that moves to the heap when
+   it overflows. an atom that lies in the port's buffer as a whole is not
+   copied at all: str then points into the port's buffer and stays valid until
+   the port is read again. */
 
-  len = 1;
-  buf = pic_malloc(pic, len + 1);
-  buf[0] = case_fold(c, p);
-  buf[1] = 0;
+#define ATOM_SIZE 64
 
-  while (! isdelim(peek(pic, file))) {
-    c = next(pic, file);
-    len += 1;
-    buf = pic_realloc(pic, buf, len + 1);
-    buf[len - 1] = case_fold(c, p);
-    buf[len] = 0;
+struct atom {
+  const char *str;
+  int len, capa;
+  char *heap;
+  char buf[ATOM_SIZE];
+};
+
+static void
+atom_append(pic_state *pic, struct atom *a, const char *s, long n)
+{
+  if (n == 0) {
+    return;
+  }
+  if (a->len + n > a->capa) {
+    a->capa = (int)(a->len + n) * 2;
+    if (a->heap == NULL) {
+      a->heap = pic_malloc(pic, a->capa);
+      memcpy(a->heap, a->buf, a->len);
+    } else {
+      a->heap = pic_realloc(pic, a->heap, a->capa);
+    }
   }
+  memcpy((a->heap ? a->heap : a->buf) + a->len, s, n);
+  a->len += (int)n;
+}
 
-  str = pic_str_value(pic, buf, len);
-  pic_free(pic, buf);
+static void
+atom_destroy(pic_state *pic, struct atom *a)
+{
+  if (a->heap) {
+    pic_free(pic, a->heap);
+  }
+}
 
-  return str;
+/* length of the run of non-delimiters at the head of the port's buffer */
+static long
+span_atom(xFILE *file)
+{
+  const unsigned char *s = (const unsigned char *)file->ptr;
+  long i = 0, n = file->cnt;
+
+  while (i < n && (char_class[s[i]] & C_DELIM) == 0) {
+    i++;
+  }
+  return i;
+}
+
+static void
+read_atom_buf(pic_state *pic, xFILE *file, int c, struct reader_control *p, struct atom *a)
+{
+  char ch = (char)c;
+  long n;
+  int i;
+
+  a->len = 0;
+  a->capa = ATOM_SIZE;
+  a->heap = NULL;
+
+  /* c is usually the character just taken from the buffer */
+  n = span_atom(file);
+  if (n < file->cnt && file->ptr > file->base && file->ptr[-1] == ch && p->typecase == CASE_DEFAULT) {
+    a->str = file->ptr - 1;
+    a->len = (int)n + 1;
+    file->ptr += n;
+    file->cnt -= n;
+    return;
+  }
+
+  atom_append(pic, a, &ch, 1);
+  while (1) {
+    atom_append(pic, a, file->ptr, n);
+    file->ptr += n;
+    file->cnt -= n;
+    if (file->cnt > 0 || isdelim(peek(pic, file))) {
+      break;
+    }
+    n = span_atom(file);
+  }
+  a->str = a->heap ? a->heap : a->buf;
+
+  if (p->typecase == CASE_FOLD) {
+    for (i = 0; i < a->len; ++i) {
+      (a->heap ? a->heap : a->buf)[i] = case_fold(a->str[i], p);
+    }
+  }
 }
 
 static pic_value
 read_symbol(pic_state *pic, xFILE *file, int c, struct reader_control *p)
 {
-  return pic_intern(pic, read_atom(pic, file, c, p));
+  struct atom a;
+  pic_value sym;
+
+  read_atom_buf(pic, file, c, p, &a);
+  sym = pic_intern_str(pic, a.str, a.len);
+  atom_destroy(pic, &a);
+
+  return sym;
+}
+
+/* plain decimal integers and reals are converted where they lie; anything
+   else goes through string->number */
+static pic_value
+parse_number(pic_state *pic, const char *s, int len)
+{
+  const unsigned char *t = (const unsigned char *)s, *e = t + len, *d;
+  char buf[64];
+  int64_t n = 0;
+  bool neg = false;
+
+  if (*t == '+' || *t == '-') {
+    neg = *t++ == '-';
+  }
+  for (d = t; t < e && (char_class[*t] & C_DIGIT); ++t) {
+    if (t - d < 18) {
+      n = n * 10 + (*t - '0');
+    }
+  }
+  if (t == d) {
+    return pic_invalid_value(pic);
+  }
+  if (t == e) {
+    if (t - d > 18 || (neg ? -n < PIC_FIXNUM_MIN : n > PIC_FIXNUM_MAX)) {
+      return pic_invalid_value(pic); /* a bignum */
+    }
+    return pic_fixnum_value(pic, neg ? -n : n);
+  }
+
+  if (*t == '.') {
+    for (++t; t < e && (char_class[*t] & C_DIGIT); ++t)
+      ;
+  }
+  if (t < e && (*t == 'e' || *t == 'E')) {
+    if (++t < e && (*t == '+' || *t == '-')) {
+      t++;
+    }
+    for (d = t; t < e && (char_class[*t] & C_DIGIT); ++t)
+      ;
+    if (t == d) {
+      return pic_invalid_value(pic);
+    }
+  }
+  if (t != e || len >= (int)sizeof buf) {
+    return pic_invalid_value(pic);
+  }
+  memcpy(buf, s, len);
+  buf[len] = '\0';
+  return pic_float_value(pic, PIC_CSTRING_TO_DOUBLE(buf));
 }
 
 static pic_value
 read_number(pic_state *pic, xFILE *file, int c, struct reader_control *p)
 {
-  pic_value str = read_atom(pic, file, c, p), num;
+  struct atom a;
+  pic_value str, num;
+
+  read_atom_buf(pic, file, c, p, &a);
+
+  num = parse_number(pic, a.str, a.len);
+  if (! pic_invalid_p(pic, num)) {
+    atom_destroy(pic, &a);
+    return num;
+  }
+  str = pic_str_value(pic, a.str, a.len);
+  atom_destroy(pic, &a);
 
   num = pic_funcall(pic, "picrin.base", "string->number", 1, str);
   if (! pic_false_p(pic, num)) {
@@ -294,9 +459,30 @@ read_char(pic_state *pic, xFILE *file, int c, struct reader_control *PIC_UNUSED(
 {
   c = next(pic, file);
 
-  if (! isdelim(peek(pic, file))) {
+  if (c >= 0x80) {
+    char buf[4];
+    int n = 0;
+
+    /* a UTF-8 encoded character */
+    buf[n++] = (char)c;
+    while (n < 4 && (peek(pic, file) & 0xc0) == 0x80) {
+      buf[n++] = (char)next(pic, file);
+    }
+    c = pic_utf8_decode(buf, n);
+  }
+  else if (! isdelim(peek(pic, file))) {
     switch (c) {
     default: read_error(pic, "unexpected character after char literal", pic_list(pic, 1, pic_char_value(pic, c)));
+    case 'x': {
+      int d;
+
+      c = 0;
+      while (! isdelim(peek(pic, file))) {
+        if ((d = hexdigit(next(pic, file))) < 0 || (c = c * 16 + d) > 0x10ffff)
+          goto fail;
+      }
+      break;
+    }
     case 'a': c = '\a'; if (! expect(pic, file, "larm")) goto fail; break;
     case 'b': c = '\b'; if (! expect(pic, file, "ackspace")) goto fail; break;
     case 'd': c = 0x7F; if (! expect(pic, file, "elete")) goto fail; break;
@@ -318,26 +504,71 @@ read_char(pic_state *pic, xFILE *file, int c, struct reader_control *PIC_UNUSED(
     }
   }
 
-  return pic_char_value(pic, (char)c);
+  return pic_char_value(pic, c);
 
  fail:
   read_error(pic, "unexpected character while reading character literal", pic_list(pic, 1, pic_char_value(pic, c)));
 }
 
+/* length of the run free of quotes and backslashes at the head of the port's
+   buffer, eight bytes at a time */
+static long
+span_string(xFILE *file)
+{
+  const char *s = file->ptr;
+  long i = 0, n = file->cnt;
+  uint64_t w, x, y;
+
+  while (n - i >= 8) {
+    memcpy(&w, s + i, 8);
+    x = w ^ 0x2222222222222222ULL; /* '"' */
+    y = w ^ 0x5c5c5c5c5c5c5c5cULL; /* '\\' */
+    if ((((x - 0x0101010101010101ULL) & ~x) | ((y - 0x0101010101010101ULL) & ~y)) & 0x8080808080808080ULL) {
+      break;
+    }
+    i += 8;
+  }
+  while (i < n && s[i] != '"' && s[i] != '\\') {
+    i++;
+  }
+  return i;
+}
+
 static pic_value
 read_string(pic_state *pic, xFILE *file, int c, struct reader_control *PIC_UNUSED(p))
 {
-  char *buf;
-  int size, cnt;
+  struct atom a;
+  char buf[4];
+  long n;
   pic_value str;
 
-  size = 256;
-  buf = pic_malloc(pic, size);
-  cnt = 0;
+  /* a literal without escapes is made straight from the buffer */
+  n = span_string(file);
+  if (n < file->cnt && file->ptr[n] == '"') {
+    str = pic_str_value(pic, file->ptr, (int)n);
+    file->ptr += n + 1;
+    file->cnt -= n + 1;
+    return str;
+  }
+
+  a.len = 0;
+  a.capa = ATOM_SIZE;
+  a.heap = NULL;
 
   /* TODO: intraline whitespaces */
 
-  while ((c = next(pic, file)) != '"') {
+  while (1) {
+    atom_append(pic, &a, file->ptr, n);
+    file->ptr += n;
+    file->cnt -= n;
+
+    if ((c = next(pic, file)) == '"') {
+      break;
+    }
+    if (c == EOF) {
+      atom_destroy(pic, &a);
+      read_error(pic, "unexpected EOF in string literal", pic_nil_value(pic));
+    }
     if (c == '\\') {
       switch (c = next(pic, file)) {
       case 'a': c = '\a'; break;
@@ -345,17 +576,29 @@ read_string(pic_state *pic, xFILE *file, int c, struct reader_control *PIC_UNUSE
       case 't': c = '\t'; break;
       case 'n': c = '\n'; break;
       case 'r': c = '\r'; break;
+      case 'x': {
+        int d;
+
+        c = 0;
+        while ((d = next(pic, file)) != ';') {
+          if ((d = hexdigit(d)) < 0 || (c = c * 16 + d) > 0x10ffff) {
+            atom_destroy(pic, &a);
+            read_error(pic, "invalid hex escape in string literal", pic_nil_value(pic));
+          }
+        }
+        atom_append(pic, &a, buf, pic_utf8_encode(c, buf));
+        n = span_string(file);
+        continue;
+      }
       }
     }
-    buf[cnt++] = (char)c;
-    if (cnt >= size) {
-      buf = pic_realloc(pic, buf, size *= 2);
-    }
+    buf[0] = (char)c;
+    atom_append(pic, &a, buf, 1);
+    n = span_string(file);
   }
-  buf[cnt] = '\0';
 
-  str = pic_str_value(pic, buf, cnt);
-  pic_free(pic, buf);
+  str = pic_str_value(pic, a.heap ? a.heap : a.buf, a.len);
+  atom_destroy(pic, &a);
   return str;
 }
 
@@ -517,18 +760,20 @@ read_vector(pic_state *pic, xFILE *file, int c, struct reader_control *p)
 static pic_value
 read_label_set(pic_state *pic, xFILE *file, int i, struct reader_control *p)
 {
-  khash_t(read) *h = &p->labels;
-  pic_value val;
-  int c, ret, it;
+  pic_value val, key = pic_int_value(pic, i);
+  int c;
 
-  it = kh_put(read, h, i, &ret);
+  if (pic_invalid_p(pic, p->labels)) {
+    p->labels = pic_make_table(pic, PIC_TABLE_EQV, false);
+  }
 
   switch ((c = skip(pic, file, ' '))) {
   case '(':
     {
       pic_value tmp;
 
-      kh_val(h, it) = val = pic_cons(pic, pic_undef_value(pic), pic_undef_value(pic));
+      val = pic_cons(pic, pic_undef_value(pic), pic_undef_value(pic));
+      pic_table_set(pic, p->labels, key, val);
 
       tmp = read(pic, file, c, p);
       pic_pair_ptr(pic, val)->car = pic_car(pic, tmp);
@@ -547,13 +792,21 @@ read_label_set(pic_state *pic, xFILE *file, int i, struct reader_control *p)
       }
 
       if (vect) {
+        struct vector *vec;
         pic_value tmp;
+        int len;
 
-        kh_val(h, it) = val = pic_make_vec(pic, 0, NULL);
+        val = pic_make_vec(pic, 0, NULL);
+        pic_table_set(pic, p->labels, key, val);
 
         tmp = read(pic, file, c, p);
-        PIC_SWAP(pic_value *, pic_vec_ptr(pic, tmp)->data, pic_vec_ptr(pic, val)->data);
-        PIC_SWAP(int, pic_vec_ptr(pic, tmp)->len, pic_vec_ptr(pic, val)->len);
+        vec = pic_vec_ptr(pic, val);
+        len = pic_vec_len(pic, tmp);
+
+        /* val may not take over tmp's payload, which can be inline */
+        vec->data = pic_malloc(pic, sizeof(pic_value) * len);
+        memcpy(vec->data, pic_vec_ptr(pic, tmp)->data, sizeof(pic_value) * len);
+        vec->len = len;
 
         return val;
       }
@@ -562,7 +815,8 @@ read_label_set(pic_state *pic, xFILE *file, int i, struct reader_control *p)
     }
   default:
     {
-      kh_val(h, it) = val = read(pic, file, c, p);
+      val = read(pic, file, c, p);
+      pic_table_set(pic, p->labels, key, val);
 
       return val;
     }
@@ -572,14 +826,12 @@ read_label_set(pic_state *pic, xFILE *file, int i, struct reader_control *p)
 static pic_value
 read_label_ref(pic_state *pic, xFILE *PIC_UNUSED(file), int i, struct reader_control *p)
 {
-  khash_t(read) *h = &p->labels;
-  int it;
+  pic_value key = pic_int_value(pic, i);
 
-  it = kh_get(read, h, i);
-  if (it == kh_end(h)) {
-    read_error(pic, "label of given index not defined", pic_list(pic, 1, pic_int_value(pic, i)));
+  if (pic_invalid_p(pic, p->labels) || ! pic_table_has(pic, p->labels, key)) {
+    read_error(pic, "label of given index not defined", pic_list(pic, 1, key));
   }
-  return kh_val(h, it);
+  return pic_table_ref(pic, p->labels, key);
 }
 
 static pic_value
@@ -667,6 +919,21 @@ reader_table_init(void)
     reader_dispatch[c] = NULL;
   }
 
+  for (c = 0; c < 256; ++c) {
+    char_class[c] = 0;
+  }
+  for (c = 0; c < 256; ++c) {
+    if (strchr(" \t\n\v\f\r", c) && c != 0) {
+      char_class[c] |= C_SPACE;
+    }
+    if (strchr("();,|\" \t\n\r", c)) {
+      char_class[c] |= C_DELIM;   /* ignores "#", "'" */
+    }
+  }
+  for (c = '0'; c <= '9'; ++c) {
+    char_class[c] |= C_DIGIT;
+  }
+
   /* default reader */
   for (c = 1; c < 256; ++c) {
     reader_table[c] = read_symbol;
@@ -706,18 +973,14 @@ reader_table_init(void)
 }
 
 static void
-reader_init(pic_state *PIC_UNUSED(pic), struct reader_control *p)
+reader_init(pic_state *pic, struct reader_control *p)
 {
   p->typecase = CASE_DEFAULT;
-  kh_init(read, &p->labels);
-}
-
-static void
-reader_destroy(pic_state *pic, struct reader_control *p)
-{
-  kh_destroy(read, &p->labels);
+  p->labels = pic_invalid_value(pic);
 }
 
+/* the reader holds nothing outside the heap, so an error can simply unwind
+   through it */
 pic_value
 pic_read(pic_state *pic, pic_value port)
 {
@@ -726,26 +989,22 @@ pic_read(pic_state *pic, pic_value port)
   pic_value val;
   xFILE *file = pic_fileno(pic, port);
   int c;
-  pic_value e;
 
   reader_init(pic, &p);
 
-  pic_try {
-    while ((c = skip(pic, file, next(pic, file))) != EOF) {
-      val = read_nullable(pic, file, c, &p);
+  while ((c = skip(pic, file, next(pic, file))) != EOF) {
+    val = read_nullable(pic, file, c, &p);
 
-      if (! pic_invalid_p(pic, val)) {
-        break;
-      }
-      pic_leave(pic, ai);
+    if (! pic_invalid_p(pic, val)) {
+      break;
     }
-    if (c == EOF) {
-      val = pic_eof_object(pic);
+    pic_leave(pic, ai);
+    if (! pic_invalid_p(pic, p.labels)) {
+      pic_protect(pic, p.labels); /* labels outlive datum comments */
     }
   }
-  pic_catch(e) {
-    reader_destroy(pic, &p);
-    pic_raise(pic, e);
+  if (c == EOF) {
+    val = pic_eof_object(pic);
   }
 
   pic_leave(pic, ai);
@@ -755,7 +1014,7 @@ pic_read(pic_state *pic, pic_value port)
 pic_value
 pic_read_cstr(pic_state *pic, const char *str)
 {
-  pic_value port = pic_open_port(pic, xfopen_buf(pic, str, strlen(str), "r"));
+  pic_value port = pic_open_port(pic, xfopen_mem(pic, str, strlen(str)));
   pic_value form, e;
 
   pic_try {
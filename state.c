@@ -96,6 +96,8 @@ void pic_init_proc(pic_state *);
 void pic_init_symbol(pic_state *);
 void pic_init_vector(pic_state *);
 void pic_init_blob(pic_state *);
+void pic_init_uvector(pic_state *);
+void pic_init_table(pic_state *);
 void pic_init_cont(pic_state *);
 void pic_init_char(pic_state *);
 void pic_init_error(pic_state *);
@@ -114,7 +116,7 @@ void pic_boot(pic_state *);
 #define DONE pic_leave(pic, ai);
 
 static void
-pic_init_core(pic_state *pic)
+pic_init_core(pic_state *pic, bool boot)
 {
   size_t ai = pic_enter(pic);
   pic_value env;
@@ -131,6 +133,8 @@ pic_init_core(pic_state *pic)
   import_builtin_syntax("begin");
   import_builtin_syntax("define-macro");
 
+  pic->lazy_defun = true;
+
   pic_init_features(pic); DONE;
   pic_init_bool(pic); DONE;
   pic_init_pair(pic); DONE;
@@ -140,6 +144,8 @@ pic_init_core(pic_state *pic)
   pic_init_symbol(pic); DONE;
   pic_init_vector(pic); DONE;
   pic_init_blob(pic); DONE;
+  pic_init_uvector(pic); DONE;
+  pic_init_table(pic); DONE;
   pic_init_cont(pic); DONE;
   pic_init_char(pic); DONE;
   pic_init_error(pic); DONE;
@@ -156,11 +162,15 @@ pic_init_core(pic_state *pic)
   pic_init_write(pic); DONE;
 #endif
 
-  pic_boot(pic); DONE;
+  pic->lazy_defun = false;
+
+  if (boot) {
+    pic_boot(pic); DONE;
+  }
 }
 
-pic_state *
-pic_open(pic_allocf allocf, void *userdata)
+static pic_state *
+open_state(pic_allocf allocf, void *userdata, bool boot)
 {
   pic_state *pic;
 
@@ -216,20 +226,26 @@ pic_open(pic_allocf allocf, void *userdata)
   /* symbol table */
   kh_init(oblist, &pic->oblist);
 
-  /* unique symbol count */
-  pic->ucnt = 0;
+  /* identifier resolution cache */
+  memset(pic->idcache, 0, sizeof pic->idcache);
+  pic->idepoch = 1;
 
   /* global variables */
   pic->globals = pic_invalid_value(pic);
 
   /* macros */
   pic->macros = pic_invalid_value(pic);
+  pic->journal = pic_false_value(pic);
 
   /* features */
   pic->features = pic_nil_value(pic);
 
   /* libraries */
   kh_init(ltable, &pic->ltable);
+
+  /* built-in procedures */
+  kh_init(builtin, &pic->builtins);
+  pic->lazy_defun = false;
   pic->lib = NULL;
 
   /* ireps */
@@ -246,8 +262,9 @@ pic_open(pic_allocf allocf, void *userdata)
   xfopen_file(pic, stdin, "r");
   xfopen_file(pic, stdout, "w");
   xfopen_file(pic, stderr, "w");
-  pic->files[1].flag |= X_LNBUF;
-  pic->files[2].flag |= X_UNBUF;
+  xsetvbuf(pic, &pic->files[0], XIONBF, 0); /* may be interactive */
+  xsetvbuf(pic, &pic->files[1], XIOLBF, 0);
+  xsetvbuf(pic, &pic->files[2], XIONBF, 0);
 #else
   xfopen_null(pic, "r");
   xfopen_null(pic, "w");
@@ -257,6 +274,22 @@ pic_open(pic_allocf allocf, void *userdata)
   /* root tables */
   pic->globals = pic_make_weak(pic);
   pic->macros = pic_make_weak(pic);
+  pic->vmprocs = pic_invalid_value(pic);
+
+  /* keywords the compiler dispatches on */
+#define S(slot, name) pic->slot = pic_sym_ptr(pic, pic_intern_lit(pic, name))
+  S(sDEFINE, "define");
+  S(sDEFINE_MACRO, "define-macro");
+  S(sLAMBDA, "lambda");
+  S(sQUOTE, "quote");
+  S(sBEGIN, "begin");
+  S(sSETBANG, "set!");
+  S(sIF, "if");
+  S(sGREF, "gref");
+  S(sCREF, "cref");
+  S(sLREF, "lref");
+  S(sCALL, "call");
+#undef S
 
   /* root block */
   pic->cp = (struct checkpoint *)pic_obj_alloc(pic, sizeof(struct checkpoint), PIC_TYPE_CP);
@@ -270,7 +303,7 @@ pic_open(pic_allocf allocf, void *userdata)
   /* turn on GC */
   pic->gc_enable = true;
 
-  pic_init_core(pic);
+  pic_init_core(pic, boot);
 
   pic_in_library(pic, "picrin.user");
 
@@ -288,6 +321,35 @@ pic_open(pic_allocf allocf, void *userdata)
   return NULL;
 }
 
+pic_state *
+pic_open(pic_allocf allocf, void *userdata)
+{
+  return open_state(allocf, userdata, true);
+}
+
+/* makes a state from a snapshot taken by pic_snapshot, instead of loading
+   the boot library. procedures defined in C that the snapshot refers to
+   must be defined by init, which is called in picrin.user beforehand.
+   returns NULL if the snapshot cannot be restored */
+pic_state *
+pic_open_snapshot(pic_allocf allocf, void *userdata, void (*init)(pic_state *), const unsigned char *buf, size_t len)
+{
+  pic_state *pic;
+
+  if ((pic = open_state(allocf, userdata, false)) == NULL) {
+    return NULL;
+  }
+  if (init) {
+    init(pic);
+  }
+  if (! pic_restore(pic, buf, len)) {
+    pic_close(pic);
+    return NULL;
+  }
+  pic_leave(pic, 0);            /* empty arena */
+  return pic;
+}
+
 void
 pic_close(pic_state *pic)
 {
@@ -300,7 +362,11 @@ pic_close(pic_state *pic)
   pic->err = pic_invalid_value(pic);
   pic->globals = pic_invalid_value(pic);
   pic->macros = pic_invalid_value(pic);
+  pic->journal = pic_false_value(pic);
+  pic->vmprocs = pic_invalid_value(pic);
   pic->features = pic_nil_value(pic);
+  pic->sDEFINE = pic->sDEFINE_MACRO = pic->sLAMBDA = pic->sQUOTE = pic->sBEGIN = pic->sSETBANG = pic->sIF = NULL;
+  pic->sGREF = pic->sCREF = pic->sLREF = pic->sCALL = NULL;
 
   /* free all libraries */
   kh_clear(ltable, &pic->ltable);
@@ -321,6 +387,7 @@ pic_close(pic_state *pic)
   /* free global stacks */
   kh_destroy(oblist, &pic->oblist);
   kh_destroy(ltable, &pic->ltable);
+  kh_destroy(builtin, &pic->builtins);
 
   /* free GC arena */
   allocf(pic->userdata, pic->arena, 0);
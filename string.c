@@ -5,15 +5,25 @@
 #include "picrin.h"
 #include "picrin/extra.h"
 #include "picrin/private/object.h"
+#include "picrin/private/file.h"
+
+/* strings are stored as UTF-8. weight counts bytes and nchars counts
+   characters; a rope whose two counts agree is pure ASCII and is indexed
+   directly. other leaves remember the last character position looked up
+   (the breadcrumb), so that walking a string in order stays linear. */
 
 struct rope {
   int refcnt;
   int weight;
+  int nchars;
   bool isleaf;
+  int depth;                    /* upper bound of the height; 0 for leaves */
+  int hash;                     /* 0 until computed */
   union {
     struct {
       struct rope *owner;
       const char *str;          /* always points to zero-term'd buf */
+      int ci, bi;               /* character ci starts at byte bi */
     } leaf;
     struct {
       struct rope *left, *right;
@@ -43,6 +53,128 @@ pic_rope_decref(pic_state *pic, struct rope *rope) {
   }
 }
 
+#define rope_ascii_p(r) ((r)->nchars == (r)->weight)
+#define utf8_cont_p(c) (((c) & 0xc0) == 0x80)
+
+/* number of characters in s[0..len), eight bytes at a time while ASCII */
+static int
+utf8_count(const char *s, int len)
+{
+  uint64_t w;
+  int i = 0, n = 0;
+
+  while (i < len) {
+    if (len - i >= 8) {
+      memcpy(&w, s + i, 8);
+      if ((w & 0x8080808080808080ULL) == 0) {
+        i += 8;
+        n += 8;
+        continue;
+      }
+    }
+    n += ! utf8_cont_p(s[i]);
+    i++;
+  }
+  return n;
+}
+
+int
+pic_utf8_encode(int c, char *buf)
+{
+  if (c < 0x80) {
+    buf[0] = c;
+    return 1;
+  }
+  if (c < 0x800) {
+    buf[0] = 0xc0 | (c >> 6);
+    buf[1] = 0x80 | (c & 0x3f);
+    return 2;
+  }
+  if (c < 0x10000) {
+    buf[0] = 0xe0 | (c >> 12);
+    buf[1] = 0x80 | ((c >> 6) & 0x3f);
+    buf[2] = 0x80 | (c & 0x3f);
+    return 3;
+  }
+  buf[0] = 0xf0 | (c >> 18);
+  buf[1] = 0x80 | ((c >> 12) & 0x3f);
+  buf[2] = 0x80 | ((c >> 6) & 0x3f);
+  buf[3] = 0x80 | (c & 0x3f);
+  return 4;
+}
+
+/* decodes the character at s, reading no more than n bytes. malformed
+   input decodes to U+FFFD. */
+int
+pic_utf8_decode(const char *s, int n)
+{
+  const unsigned char *u = (const unsigned char *)s;
+  int c, k, i;
+
+  if (u[0] < 0x80) {
+    return u[0];
+  }
+  if (u[0] >= 0xf0 && u[0] < 0xf8) {
+    c = u[0] & 0x07;
+    k = 4;
+  } else if (u[0] >= 0xe0) {
+    c = u[0] & 0x0f;
+    k = 3;
+  } else if (u[0] >= 0xc0) {
+    c = u[0] & 0x1f;
+    k = 2;
+  } else {
+    return 0xfffd;
+  }
+  if (u[0] >= 0xf8 || k > n) {
+    return 0xfffd;
+  }
+  for (i = 1; i < k; ++i) {
+    if (! utf8_cont_p(u[i])) {
+      return 0xfffd;
+    }
+    c = (c << 6) | (u[i] & 0x3f);
+  }
+  return c;
+}
+
+/* byte offset of the i-th character of a leaf */
+static int
+leaf_offset(struct rope *leaf, int i)
+{
+  const char *s = leaf->u.leaf.str;
+  int ci, bi;
+
+  assert(leaf->isleaf && 0 <= i && i <= leaf->nchars);
+
+  if (rope_ascii_p(leaf)) {
+    return i;
+  }
+  if (i == leaf->nchars) {
+    return leaf->weight;
+  }
+  ci = leaf->u.leaf.ci;
+  bi = leaf->u.leaf.bi;
+  if (i < ci - i) {
+    ci = bi = 0;
+  }
+  while (ci < i) {
+    do {
+      bi++;
+    } while (bi < leaf->weight && utf8_cont_p(s[bi]));
+    ci++;
+  }
+  while (ci > i) {
+    do {
+      bi--;
+    } while (bi > 0 && utf8_cont_p(s[bi]));
+    ci--;
+  }
+  leaf->u.leaf.ci = ci;
+  leaf->u.leaf.bi = bi;
+  return bi;
+}
+
 static struct rope *
 make_rope_leaf(pic_state *pic, const char *str, int len)
 {
@@ -51,12 +183,17 @@ make_rope_leaf(pic_state *pic, const char *str, int len)
   rope = pic_malloc(pic, offsetof(struct rope, buf) + len + 1);
   rope->refcnt = 1;
   rope->weight = len;
+  rope->nchars = len;
   rope->isleaf = true;
+  rope->depth = 0;
+  rope->hash = 0;
   rope->u.leaf.owner = NULL;
   rope->u.leaf.str = rope->buf;
+  rope->u.leaf.ci = rope->u.leaf.bi = 0;
   rope->buf[len] = 0;
   if (str) {
     memcpy(rope->buf, str, len);
+    rope->nchars = utf8_count(str, len);
   }
 
   return rope;
@@ -70,36 +207,52 @@ make_rope_lit(pic_state *pic, const char *str, int len)
   rope = pic_malloc(pic, offsetof(struct rope, buf));
   rope->refcnt = 1;
   rope->weight = len;
+  rope->nchars = utf8_count(str, len);
   rope->isleaf = true;
+  rope->depth = 0;
+  rope->hash = 0;
   rope->u.leaf.owner = NULL;
   rope->u.leaf.str = str;
+  rope->u.leaf.ci = rope->u.leaf.bi = 0;
 
   return rope;
 }
 
+/* characters i to j of a leaf */
 static struct rope *
 make_rope_slice(pic_state *pic, struct rope *owner, int i, int j)
 {
   struct rope *rope;
+  const char *str;
+  int bi, bj;
 
   assert(owner->isleaf);
 
+  bi = leaf_offset(owner, i);
+  bj = leaf_offset(owner, j);
+  str = owner->u.leaf.str + bi;
   if (owner->u.leaf.owner != NULL) {
     owner = owner->u.leaf.owner;
   }
 
   rope = pic_malloc(pic, offsetof(struct rope, buf));
   rope->refcnt = 1;
-  rope->weight = j - i;
+  rope->weight = bj - bi;
+  rope->nchars = j - i;
   rope->isleaf = true;
+  rope->depth = 0;
+  rope->hash = 0;
   rope->u.leaf.owner = owner;
-  rope->u.leaf.str = owner->u.leaf.str + i;
+  rope->u.leaf.str = str;
+  rope->u.leaf.ci = rope->u.leaf.bi = 0;
 
   pic_rope_incref(owner);
 
   return rope;
 }
 
+#define rope_depth(r) ((r)->isleaf ? 0 : (r)->depth)
+
 static struct rope *
 make_rope_node(pic_state *pic, struct rope *left, struct rope *right)
 {
@@ -108,96 +261,407 @@ make_rope_node(pic_state *pic, struct rope *left, struct rope *right)
   rope = pic_malloc(pic, sizeof(struct rope));
   rope->refcnt = 1;
   rope->weight = left->weight + right->weight;
+  rope->nchars = left->nchars + right->nchars;
   rope->isleaf = false;
+  rope->depth = 1 + (rope_depth(left) > rope_depth(right) ? rope_depth(left) : rope_depth(right));
+  rope->hash = 0;
   rope->u.node.left = pic_rope_incref(left);
   rope->u.node.right = pic_rope_incref(right);
 
   return rope;
 }
 
+/* the contiguous run of characters starting at index i */
+static const char *
+rope_seg(struct rope *rope, int i, int *n)
+{
+  while (! rope->isleaf) {
+    if (i < rope->u.node.left->weight) {
+      rope = rope->u.node.left;
+    } else {
+      i -= rope->u.node.left->weight;
+      rope = rope->u.node.right;
+    }
+  }
+  *n = rope->weight - i;
+  return rope->u.leaf.str + i;
+}
+
+static void
+rope_copy(struct rope *rope, int i, int len, char *dst)
+{
+  const char *p;
+  int n;
+
+  while (len > 0) {
+    p = rope_seg(rope, i, &n);
+    if (n > len) {
+      n = len;
+    }
+    memcpy(dst, p, n);
+    dst += n;
+    i += n;
+    len -= n;
+  }
+}
+
+/* conversions between character indices and byte offsets */
+
+static int
+rope_byte_offset(struct rope *rope, int i)
+{
+  int b = 0;
+
+  while (! rope->isleaf) {
+    if (rope_ascii_p(rope)) {
+      return b + i;
+    }
+    if (i < rope->u.node.left->nchars) {
+      rope = rope->u.node.left;
+    } else {
+      i -= rope->u.node.left->nchars;
+      b += rope->u.node.left->weight;
+      rope = rope->u.node.right;
+    }
+  }
+  return b + leaf_offset(rope, i);
+}
+
+/* b must be at a character boundary */
+static int
+rope_char_index(struct rope *rope, int b)
+{
+  int i = 0, ci, bi;
+
+  while (! rope->isleaf) {
+    if (rope_ascii_p(rope)) {
+      return i + b;
+    }
+    if (b < rope->u.node.left->weight) {
+      rope = rope->u.node.left;
+    } else {
+      b -= rope->u.node.left->weight;
+      i += rope->u.node.left->nchars;
+      rope = rope->u.node.right;
+    }
+  }
+  if (rope_ascii_p(rope)) {
+    return i + b;
+  }
+  ci = rope->u.leaf.ci;
+  bi = rope->u.leaf.bi;
+  if (bi <= b) {
+    ci += utf8_count(rope->u.leaf.str + bi, b - bi);
+  } else {
+    ci = utf8_count(rope->u.leaf.str, b);
+  }
+  rope->u.leaf.ci = ci;
+  rope->u.leaf.bi = b;
+  return i + ci;
+}
+
+/* strings shorter than PIC_STR_INLINE_SIZE keep their characters in the
+   string object and have no rope. read-only kernels see them through a
+   leaf on the caller's stack; anything that links them into another rope
+   takes a fresh leaf instead. */
+
 static pic_value
-make_str(pic_state *pic, struct rope *rope)
+make_inline_str(pic_state *pic, const char *s, int len)
 {
   struct string *str;
 
+  assert(len < PIC_STR_INLINE_SIZE);
+
   str = (struct string *)pic_obj_alloc(pic, sizeof(struct string), PIC_TYPE_STRING);
-  str->rope = rope;             /* delegate ownership */
+  str->inline_len = len + 1;
+  memcpy(str->u.buf, s, len);
+  str->u.buf[len] = 0;
+
+  return pic_obj_value(str);
+}
 
+static pic_value
+make_str(pic_state *pic, struct rope *rope)
+{
+  struct string *str;
+
+  if (rope->weight < PIC_STR_INLINE_SIZE) {
+    str = (struct string *)pic_obj_alloc(pic, sizeof(struct string), PIC_TYPE_STRING);
+    str->inline_len = rope->weight + 1;
+    rope_copy(rope, 0, rope->weight, str->u.buf);
+    str->u.buf[rope->weight] = 0;
+    pic_rope_decref(pic, rope);
+  } else {
+    str = (struct string *)pic_obj_alloc(pic, sizeof(struct string), PIC_TYPE_STRING);
+    str->inline_len = 0;
+    str->u.rope = rope;         /* delegate ownership */
+  }
   return pic_obj_value(str);
 }
 
+static struct rope *
+str_view(struct string *str, struct rope *tmp)
+{
+  if (str->inline_len == 0) {
+    return str->u.rope;
+  }
+  tmp->refcnt = 1;
+  tmp->weight = str->inline_len - 1;
+  tmp->nchars = utf8_count(str->u.buf, tmp->weight);
+  tmp->isleaf = true;
+  tmp->depth = 0;
+  tmp->hash = 0;
+  tmp->u.leaf.owner = NULL;
+  tmp->u.leaf.str = str->u.buf;
+  tmp->u.leaf.ci = tmp->u.leaf.bi = 0;
+  return tmp;
+}
+
+/* returns a new reference */
+static struct rope *
+str_share(pic_state *pic, struct string *str)
+{
+  if (str->inline_len == 0) {
+    return pic_rope_incref(str->u.rope);
+  }
+  return make_rope_leaf(pic, str->u.buf, str->inline_len - 1);
+}
+
+#define STR_VIEW(pic, v, tmp) str_view(pic_str_ptr(pic, v), &(tmp))
+
+/* concatenation keeps ropes AVL-balanced: the depth of the two halves of a
+   node differs by at most one, and short neighbouring leaves are coalesced.
+   depth fields may overestimate after flatten, which only costs balance. */
+
+static struct rope *
+make_rope_node_drop(pic_state *pic, struct rope *left, struct rope *right)
+{
+  struct rope *rope = make_rope_node(pic, left, right);
+
+  pic_rope_decref(pic, left);
+  pic_rope_decref(pic, right);
+  return rope;
+}
+
+/* left and right differ in depth by at most two */
+static struct rope *
+rebalance(pic_state *pic, struct rope *left, struct rope *right)
+{
+  int dl = rope_depth(left), dr = rope_depth(right);
+
+  if (dl > dr + 1) {
+    struct rope *ll = left->u.node.left, *lr = left->u.node.right;
+
+    if (rope_depth(ll) >= rope_depth(lr)) {
+      return make_rope_node_drop(pic, pic_rope_incref(ll), make_rope_node(pic, lr, right));
+    } else {
+      return make_rope_node_drop(pic,
+                                 make_rope_node(pic, ll, lr->u.node.left),
+                                 make_rope_node(pic, lr->u.node.right, right));
+    }
+  }
+  if (dr > dl + 1) {
+    struct rope *rl = right->u.node.left, *rr = right->u.node.right;
+
+    if (rope_depth(rr) >= rope_depth(rl)) {
+      return make_rope_node_drop(pic, make_rope_node(pic, left, rl), pic_rope_incref(rr));
+    } else {
+      return make_rope_node_drop(pic,
+                                 make_rope_node(pic, left, rl->u.node.left),
+                                 make_rope_node(pic, rl->u.node.right, rr));
+    }
+  }
+  return make_rope_node(pic, left, right);
+}
+
+#define short_leaf_p(r, n) ((r)->isleaf && (r)->weight + (n) <= PIC_ROPE_LEAF_SIZE)
+
 static struct rope *
 merge(pic_state *pic, struct rope *left, struct rope *right)
 {
-  if (left == 0)
+  struct rope *t, *rope;
+  int dl, dr;
+
+  if (left == 0 || left->weight == 0)
     return pic_rope_incref(right);
-  if (right == 0)
+  if (right == 0 || right->weight == 0)
     return pic_rope_incref(left);
 
+  if (short_leaf_p(left, right->weight) && right->isleaf) {
+    rope = make_rope_leaf(pic, 0, left->weight + right->weight);
+    rope->nchars = left->nchars + right->nchars;
+    memcpy(rope->buf, left->u.leaf.str, left->weight);
+    memcpy(rope->buf + left->weight, right->u.leaf.str, right->weight);
+    return rope;
+  }
+
+  dl = rope_depth(left);
+  dr = rope_depth(right);
+
+  /* descending along the inner spine recurses at most depth times */
+  if (dl > dr + 1 || (! left->isleaf && right->isleaf && short_leaf_p(left->u.node.right, right->weight))) {
+    t = merge(pic, left->u.node.right, right);
+    rope = rebalance(pic, left->u.node.left, t);
+    pic_rope_decref(pic, t);
+    return rope;
+  }
+  if (dr > dl + 1 || (! right->isleaf && left->isleaf && short_leaf_p(right->u.node.left, left->weight))) {
+    t = merge(pic, left, right->u.node.left);
+    rope = rebalance(pic, t, right->u.node.right);
+    pic_rope_decref(pic, t);
+    return rope;
+  }
   return make_rope_node(pic, left, right);
 }
 
+/* slices are taken without recursion: the part of each subtree that lies
+   off the descent path is joined onto an accumulator */
+
 static struct rope *
-slice(pic_state *pic, struct rope *rope, int i, int j)
+slice_suffix(pic_state *pic, struct rope *rope, int i)
 {
-  int lweight;
-
-  if (i == 0 && rope->weight == j) {
-    return pic_rope_incref(rope);
+  struct rope *acc = NULL, *t;
+  int lchars;
+
+  while (i > 0 && ! rope->isleaf) {
+    lchars = rope->u.node.left->nchars;
+    if (i < lchars) {
+      t = merge(pic, rope->u.node.right, acc);
+      if (acc) pic_rope_decref(pic, acc);
+      acc = t;
+      rope = rope->u.node.left;
+    } else {
+      i -= lchars;
+      rope = rope->u.node.right;
+    }
+  }
+  rope = i == 0 ? pic_rope_incref(rope) : make_rope_slice(pic, rope, i, rope->nchars);
+  if (acc) {
+    t = merge(pic, rope, acc);
+    pic_rope_decref(pic, rope);
+    pic_rope_decref(pic, acc);
+    rope = t;
   }
+  return rope;
+}
 
-  if (rope->isleaf) {
-    return make_rope_slice(pic, rope, i, j);
+static struct rope *
+slice_prefix(pic_state *pic, struct rope *rope, int j)
+{
+  struct rope *acc = NULL, *t;
+  int lchars;
+
+  while (j < rope->nchars && ! rope->isleaf) {
+    lchars = rope->u.node.left->nchars;
+    if (j <= lchars) {
+      rope = rope->u.node.left;
+    } else {
+      t = merge(pic, acc, rope->u.node.left);
+      if (acc) pic_rope_decref(pic, acc);
+      acc = t;
+      j -= lchars;
+      rope = rope->u.node.right;
+    }
+  }
+  rope = j == rope->nchars ? pic_rope_incref(rope) : make_rope_slice(pic, rope, 0, j);
+  if (acc) {
+    t = merge(pic, acc, rope);
+    pic_rope_decref(pic, rope);
+    pic_rope_decref(pic, acc);
+    rope = t;
   }
+  return rope;
+}
 
-  lweight = rope->u.node.left->weight;
+static struct rope *
+slice(pic_state *pic, struct rope *rope, int i, int j)
+{
+  struct rope *l, *r;
+  int lchars;
 
-  if (j <= lweight) {
-    return slice(pic, rope->u.node.left, i, j);
-  } else if (lweight <= i) {
-    return slice(pic, rope->u.node.right, i - lweight, j - lweight);
-  } else {
-    struct rope *r, *l;
+  while (! (i == 0 && rope->nchars == j)) {
+    if (rope->isleaf) {
+      return make_rope_slice(pic, rope, i, j);
+    }
 
-    l = slice(pic, rope->u.node.left, i, lweight);
-    r = slice(pic, rope->u.node.right, 0, j - lweight);
-    rope = merge(pic, l, r);
+    lchars = rope->u.node.left->nchars;
 
-    pic_rope_decref(pic, l);
-    pic_rope_decref(pic, r);
+    if (j <= lchars) {
+      rope = rope->u.node.left;
+    } else if (lchars <= i) {
+      rope = rope->u.node.right;
+      i -= lchars;
+      j -= lchars;
+    } else {
+      l = slice_suffix(pic, rope->u.node.left, i);
+      r = slice_prefix(pic, rope->u.node.right, j - lchars);
+      rope = merge(pic, l, r);
 
-    return rope;
+      pic_rope_decref(pic, l);
+      pic_rope_decref(pic, r);
+
+      return rope;
+    }
   }
+  return pic_rope_incref(rope);
 }
 
+/* copies the contents of rope into owner's buffer and turns rope into a leaf
+   viewing it. the traversal uses an explicit stack bounded by the depth. */
 static void
-flatten(pic_state *pic, struct rope *rope, struct rope *owner, char *buf)
+flatten(pic_state *pic, struct rope *rope, struct rope *owner)
 {
-  if (rope->isleaf) {
-    memcpy(buf, rope->u.leaf.str, rope->weight);
-  } else {
-    flatten(pic, rope->u.node.left, owner, buf);
-    flatten(pic, rope->u.node.right, owner, buf + rope->u.node.left->weight);
+  struct rope **stack, *r;
+  char *buf = owner->buf;
+  int sp = 0;
+
+  stack = pic_malloc(pic, sizeof(struct rope *) * (rope_depth(rope) + 1));
+  stack[sp++] = rope;
+  while (sp > 0) {
+    r = stack[--sp];
+    while (! r->isleaf) {
+      stack[sp++] = r->u.node.right;
+      r = r->u.node.left;
+    }
+    memcpy(buf, r->u.leaf.str, r->weight);
+    buf += r->weight;
   }
+  pic_free(pic, stack);
 
   /* path compression */
 
-  if (! rope->isleaf) {
-    pic_rope_incref(owner);
+  pic_rope_incref(owner);
+  if (rope->isleaf) {
+    if (rope->u.leaf.owner) {
+      pic_rope_decref(pic, rope->u.leaf.owner);
+    }
+  } else {
     pic_rope_decref(pic, rope->u.node.left);
     pic_rope_decref(pic, rope->u.node.right);
     rope->isleaf = true;
-    rope->u.leaf.owner = owner;
-    rope->u.leaf.str = buf;
+    rope->depth = 0;
   }
+  rope->u.leaf.owner = owner;
+  rope->u.leaf.str = owner->buf;
+  rope->u.leaf.ci = rope->u.leaf.bi = 0;
 }
 
 static void
 str_update(pic_state *pic, pic_value dst, pic_value src)
 {
-  pic_rope_incref(pic_str_ptr(pic, src)->rope);
-  pic_rope_decref(pic, pic_str_ptr(pic, dst)->rope);
-  pic_str_ptr(pic, dst)->rope = pic_str_ptr(pic, src)->rope;
+  struct string *d = pic_str_ptr(pic, dst), *s = pic_str_ptr(pic, src);
+
+  if (d == s) {
+    return;
+  }
+  if (s->inline_len == 0) {
+    pic_rope_incref(s->u.rope);
+  }
+  if (d->inline_len == 0) {
+    pic_rope_decref(pic, d->u.rope);
+  }
+  d->inline_len = s->inline_len;
+  d->u = s->u;
 }
 
 pic_value
@@ -205,12 +669,15 @@ pic_str_value(pic_state *pic, const char *str, int len)
 {
   struct rope *r;
 
+  if (len == 0) {
+    return make_inline_str(pic, "", 0);
+  }
+  if (len > -PIC_STR_INLINE_SIZE && len < PIC_STR_INLINE_SIZE) {
+    return make_inline_str(pic, str, len < 0 ? -len : len);
+  }
   if (len > 0) {
     r = make_rope_leaf(pic, str, len);
   } else {
-    if (len == 0) {
-      str = "";
-    }
     r = make_rope_lit(pic, str, -len);
   }
   return make_str(pic, r);
@@ -234,37 +701,164 @@ pic_vstrf_value(pic_state *pic, const char *fmt, va_list ap)
 {
   pic_value str;
   xFILE *file;
-  const char *buf;
-  int len;
 
-  file = xfopen_buf(pic, NULL, 0, "w");
+  file = xfopen_str(pic);
 
   xvfprintf(pic, file, fmt, ap);
-  xfget_buf(pic, file, &buf, &len);
-  str = pic_str_value(pic, buf, len);
+  xfget_str(pic, file, &str);
   xfclose(pic, file);
   return str;
 }
 
+/* string builder: output is written straight into a growing leaf that
+   becomes part of the resulting string. a leaf that has been handed out is
+   frozen and joined onto the accumulated rope, so get-output-string never
+   copies what has been written so far. */
+
+struct strbuf {
+  struct rope *acc;             /* frozen prefix, or NULL */
+  struct rope *cur;             /* leaf being filled, or NULL */
+  int capa;                     /* capacity of cur, not counting the nul */
+};
+
+static int
+strbuf_write(pic_state *pic, void *cookie, const char *ptr, int size)
+{
+  struct strbuf *b = cookie;
+  struct rope *cur = b->cur;
+  int len = cur ? cur->weight : 0;
+
+  if (cur == NULL || len + size > b->capa) {
+    b->capa = (len + size) * 2;
+    if (b->capa < PIC_ROPE_LEAF_SIZE) {
+      b->capa = PIC_ROPE_LEAF_SIZE;
+    }
+    cur = pic_realloc(pic, cur, offsetof(struct rope, buf) + b->capa + 1);
+    if (b->cur == NULL) {
+      cur->refcnt = 1;
+      cur->weight = 0;
+      cur->nchars = 0;
+      cur->isleaf = true;
+      cur->depth = 0;
+      cur->hash = 0;
+      cur->u.leaf.owner = NULL;
+      cur->u.leaf.ci = cur->u.leaf.bi = 0;
+    }
+    cur->u.leaf.str = cur->buf;
+    b->cur = cur;
+  }
+  memcpy(cur->buf + len, ptr, size);
+  cur->weight = len + size;
+  cur->nchars += utf8_count(ptr, size);
+  cur->buf[cur->weight] = 0;
+  return size;
+}
+
+static long
+strbuf_seek(pic_state *PIC_UNUSED(pic), void *PIC_UNUSED(cookie), long PIC_UNUSED(pos), int PIC_UNUSED(whence))
+{
+  return -1;
+}
+
+static int
+strbuf_close(pic_state *pic, void *cookie)
+{
+  struct strbuf *b = cookie;
+
+  if (b->acc) {
+    pic_rope_decref(pic, b->acc);
+  }
+  if (b->cur) {
+    pic_rope_decref(pic, b->cur);
+  }
+  pic_free(pic, b);
+  return 0;
+}
+
+xFILE *
+xfopen_str(pic_state *pic)
+{
+  struct strbuf *b;
+  xFILE *file;
+
+  b = pic_malloc(pic, sizeof(struct strbuf));
+  b->acc = NULL;
+  b->cur = NULL;
+  b->capa = 0;
+
+  file = xfunopen(pic, b, NULL, strbuf_write, strbuf_seek, strbuf_close);
+  if (file == NULL) {
+    strbuf_close(pic, b);
+  } else {
+    /* the leaf is a buffer already; anything but short writes goes there */
+    xsetvbuf(pic, file, XIOFBF, PIC_ROPE_LEAF_SIZE);
+  }
+  return file;
+}
+
+int
+xfget_str(pic_state *pic, xFILE *file, pic_value *str)
+{
+  struct strbuf *b;
+  struct rope *t;
+
+  xfflush(pic, file);
+
+  if (file->vtable.write != strbuf_write) {
+    return -1;
+  }
+  b = file->vtable.cookie;
+  if (b->cur) {
+    /* give back the slack before the leaf becomes immutable */
+    b->cur = pic_realloc(pic, b->cur, offsetof(struct rope, buf) + b->cur->weight + 1);
+    b->cur->u.leaf.str = b->cur->buf;
+    t = merge(pic, b->acc, b->cur);
+    if (b->acc) {
+      pic_rope_decref(pic, b->acc);
+    }
+    pic_rope_decref(pic, b->cur);
+    b->acc = t;
+    b->cur = NULL;
+  }
+  if (b->acc == NULL) {
+    *str = pic_lit_value(pic, "");
+  } else {
+    *str = make_str(pic, pic_rope_incref(b->acc));
+  }
+  return 0;
+}
+
 int
 pic_str_len(pic_state *PIC_UNUSED(pic), pic_value str)
 {
-  return pic_str_ptr(pic, str)->rope->weight;
+  struct string *s = pic_str_ptr(pic, str);
+
+  return s->inline_len ? utf8_count(s->u.buf, s->inline_len - 1) : s->u.rope->nchars;
+}
+
+int
+pic_str_nbytes(pic_state *PIC_UNUSED(pic), pic_value str)
+{
+  struct string *s = pic_str_ptr(pic, str);
+
+  return s->inline_len ? s->inline_len - 1 : s->u.rope->weight;
 }
 
-char
+int
 pic_str_ref(pic_state *PIC_UNUSED(pic), pic_value str, int i)
 {
-  struct rope *rope = pic_str_ptr(pic, str)->rope;
+  struct rope tmp, *rope = STR_VIEW(pic, str, tmp);
+  int b;
 
-  while (i < rope->weight) {
+  while (i < rope->nchars) {
     if (rope->isleaf) {
-      return rope->u.leaf.str[i];
+      b = leaf_offset(rope, i);
+      return pic_utf8_decode(rope->u.leaf.str + b, rope->weight - b);
     }
-    if (i < rope->u.node.left->weight) {
+    if (i < rope->u.node.left->nchars) {
       rope = rope->u.node.left;
     } else {
-      i -= rope->u.node.left->weight;
+      i -= rope->u.node.left->nchars;
       rope = rope->u.node.right;
     }
   }
@@ -274,48 +868,289 @@ pic_str_ref(pic_state *PIC_UNUSED(pic), pic_value str, int i)
 pic_value
 pic_str_cat(pic_state *pic, pic_value a, pic_value b)
 {
-  return make_str(pic, merge(pic, pic_str_ptr(pic, a)->rope, pic_str_ptr(pic, b)->rope));
+  struct rope ta, tb, *ra = STR_VIEW(pic, a, ta), *rb = STR_VIEW(pic, b, tb), *r;
+  char buf[PIC_STR_INLINE_SIZE];
+
+  if (ra->weight + rb->weight < PIC_STR_INLINE_SIZE) {
+    rope_copy(ra, 0, ra->weight, buf);
+    rope_copy(rb, 0, rb->weight, buf + ra->weight);
+    return make_inline_str(pic, buf, ra->weight + rb->weight);
+  }
+  ra = str_share(pic, pic_str_ptr(pic, a));
+  rb = str_share(pic, pic_str_ptr(pic, b));
+  r = merge(pic, ra, rb);
+  pic_rope_decref(pic, ra);
+  pic_rope_decref(pic, rb);
+  return make_str(pic, r);
 }
 
 pic_value
 pic_str_sub(pic_state *pic, pic_value str, int s, int e)
 {
-  return make_str(pic, slice(pic, pic_str_ptr(pic, str)->rope, s, e));
+  struct rope tmp, *rope = STR_VIEW(pic, str, tmp);
+  char buf[PIC_STR_INLINE_SIZE];
+  int bs, be;
+
+  if (e - s < PIC_STR_INLINE_SIZE) {
+    bs = rope_ascii_p(rope) ? s : rope_byte_offset(rope, s);
+    be = rope_ascii_p(rope) ? e : rope_byte_offset(rope, e);
+    if (be - bs < PIC_STR_INLINE_SIZE) {
+      rope_copy(rope, bs, be - bs, buf);
+      return make_inline_str(pic, buf, be - bs);
+    }
+  }
+  return make_str(pic, slice(pic, rope, s, e));
+}
+
+/* compares the first len characters leaf run by leaf run */
+static int
+rope_cmp(struct rope *a, struct rope *b, int len)
+{
+  const char *pa, *pb;
+  int i = 0, na, nb, n, r;
+
+  if (a == b) {
+    return 0;
+  }
+  while (i < len) {
+    pa = rope_seg(a, i, &na);
+    pb = rope_seg(b, i, &nb);
+    n = na < nb ? na : nb;
+    if (n > len - i) {
+      n = len - i;
+    }
+    if ((r = memcmp(pa, pb, n)) != 0) {
+      return r;
+    }
+    i += n;
+  }
+  return 0;
+}
+
+/* search kernels: memchr over each leaf run finds candidates, which are
+   then verified run by run */
+
+static int
+rope_index(struct rope *rope, int c, int start, int end)
+{
+  const char *p, *q;
+  int i, n;
+
+  for (i = start; i < end; i += n) {
+    p = rope_seg(rope, i, &n);
+    if (n > end - i) {
+      n = end - i;
+    }
+    if ((q = memchr(p, c, n)) != NULL) {
+      return i + (int)(q - p);
+    }
+  }
+  return -1;
+}
+
+static bool
+rope_match(struct rope *rope, int i, const char *pat, int m)
+{
+  const char *p;
+  int n;
+
+  while (m > 0) {
+    p = rope_seg(rope, i, &n);
+    if (n > m) {
+      n = m;
+    }
+    if (memcmp(p, pat, n) != 0) {
+      return false;
+    }
+    i += n;
+    pat += n;
+    m -= n;
+  }
+  return true;
+}
+
+static int
+rope_search(struct rope *rope, const char *pat, int m, int start, int end)
+{
+  int i = start;
+
+  if (m == 0) {
+    return start;
+  }
+  while ((i = rope_index(rope, (unsigned char)pat[0], i, end - m + 1)) != -1) {
+    if (rope_match(rope, i + 1, pat + 1, m - 1)) {
+      return i;
+    }
+    i++;
+  }
+  return -1;
+}
+
+/* the same in character indices */
+static int
+str_search(struct rope *rope, const char *pat, int m, int start, int end)
+{
+  int i;
+
+  if (rope_ascii_p(rope)) {
+    return rope_search(rope, pat, m, start, end);
+  }
+  i = rope_search(rope, pat, m, rope_byte_offset(rope, start), rope_byte_offset(rope, end));
+
+  return i == -1 ? -1 : rope_char_index(rope, i);
 }
 
 int
 pic_str_cmp(pic_state *pic, pic_value str1, pic_value str2)
 {
-  return strcmp(pic_str(pic, str1), pic_str(pic, str2));
+  struct rope ta, tb, *a = STR_VIEW(pic, str1, ta), *b = STR_VIEW(pic, str2, tb);
+  int r;
+
+  r = rope_cmp(a, b, a->weight < b->weight ? a->weight : b->weight);
+  if (r != 0) {
+    return r;
+  }
+  return a->weight - b->weight;
+}
+
+bool
+pic_str_equal_p(pic_state *pic, pic_value str1, pic_value str2)
+{
+  struct rope ta, tb, *a = STR_VIEW(pic, str1, ta), *b = STR_VIEW(pic, str2, tb);
+
+  if (a->weight != b->weight) {
+    return false;
+  }
+  if (a->hash != 0 && b->hash != 0 && a->hash != b->hash) {
+    return false;
+  }
+  return rope_cmp(a, b, a->weight) == 0;
+}
+
+bool
+pic_str_prefix_p(pic_state *pic, pic_value prefix, pic_value str)
+{
+  struct rope ta, tb, *a = STR_VIEW(pic, prefix, ta), *b = STR_VIEW(pic, str, tb);
+
+  return a->weight <= b->weight && rope_cmp(a, b, a->weight) == 0;
+}
+
+/* processes eight bytes per step; the tail is read as a partial word.
+   never returns 0, which marks an uncomputed hash. */
+
+#define HASH_M 0x9e3779b97f4a7c15ULL
+#define HASH_STEP(h, w) ((h) = ((h) ^ (w)) * HASH_M, (h) ^= (h) >> 29)
+
+static int
+hash_final(uint64_t h)
+{
+  /* murmur3 fmix64 */
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return (uint32_t)h == 0 ? 1 : (int)(uint32_t)h;
+}
+
+int
+pic_str_hash_bytes(const char *s, int len)
+{
+  uint64_t h = (uint64_t)len * HASH_M, w;
+
+  while (len >= 8) {
+    memcpy(&w, s, 8);
+    HASH_STEP(h, w);
+    s += 8;
+    len -= 8;
+  }
+  if (len > 0) {
+    w = 0;
+    memcpy(&w, s, len);
+    HASH_STEP(h, w);
+  }
+  return hash_final(h);
+}
+
+/* same as pic_str_hash_bytes on the contents, carrying partial words over
+   leaf boundaries */
+static int
+rope_hash(struct rope *rope)
+{
+  uint64_t h = (uint64_t)rope->weight * HASH_M, w;
+  unsigned char part[8];
+  const char *p;
+  int i, j, n, k = 0;
+
+  if (rope->isleaf) {
+    return pic_str_hash_bytes(rope->u.leaf.str, rope->weight);
+  }
+  for (i = 0; i < rope->weight; i += n) {
+    p = rope_seg(rope, i, &n);
+    for (j = 0; j < n; ) {
+      if (k == 0 && n - j >= 8) {
+        memcpy(&w, p + j, 8);
+        HASH_STEP(h, w);
+        j += 8;
+      } else {
+        part[k++] = p[j++];
+        if (k == 8) {
+          memcpy(&w, part, 8);
+          HASH_STEP(h, w);
+          k = 0;
+        }
+      }
+    }
+  }
+  if (k > 0) {
+    w = 0;
+    memcpy(&w, part, k);
+    HASH_STEP(h, w);
+  }
+  return hash_final(h);
 }
 
 int
 pic_str_hash(pic_state *pic, pic_value str)
 {
-  const char *s;
-  int h = 0;
+  struct string *s = pic_str_ptr(pic, str);
+  struct rope *rope;
+
+  if (s->inline_len) {
+    return pic_str_hash_bytes(s->u.buf, s->inline_len - 1);
+  }
+  rope = s->u.rope;
 
-  s = pic_str(pic, str);
-  while (*s) {
-    h = (h << 5) - h + *s++;
+  /* ropes are immutable, so the hash stays valid until string-set! et al.
+     replace the string's rope */
+  if (rope->hash == 0) {
+    rope->hash = rope_hash(rope);
   }
-  return h;
+  return rope->hash;
 }
 
 const char *
 pic_str(pic_state *pic, pic_value str)
 {
-  struct rope *rope = pic_str_ptr(pic, str)->rope, *r;
+  struct string *s = pic_str_ptr(pic, str);
+  struct rope *rope, *r;
+
+  if (s->inline_len) {
+    return s->u.buf;
+  }
+  rope = s->u.rope;
 
   if (rope->isleaf && rope->u.leaf.str[rope->weight] == '\0') {
     return rope->u.leaf.str;
   }
 
   r = make_rope_leaf(pic, 0, rope->weight);
+  r->nchars = rope->nchars;
 
-  flatten(pic, rope, r, r->buf);
+  flatten(pic, rope, r);
+  pic_rope_decref(pic, r);      /* now owned by rope */
 
-  return r->u.leaf.str;
+  return rope->u.leaf.str;
 }
 
 static pic_value
@@ -331,40 +1166,53 @@ pic_str_string_p(pic_state *pic)
 static pic_value
 pic_str_string(pic_state *pic)
 {
-  int argc, i;
+  int argc, i, len = 0;
   pic_value *argv;
   char *buf;
 
   pic_get_args(pic, "*", &argc, &argv);
 
-  buf = pic_alloca(pic, argc);
+  buf = pic_alloca(pic, argc * 4);
 
   for (i = 0; i < argc; ++i) {
     TYPE_CHECK(pic, argv[i], char);
-    buf[i] = pic_char(pic, argv[i]);
+    len += pic_utf8_encode(pic_char(pic, argv[i]), buf + len);
   }
 
-  return pic_str_value(pic, buf, argc);
+  return pic_str_value(pic, buf, len);
+}
+
+/* a string of len copies of c */
+static pic_value
+str_fill(pic_state *pic, int c, int len)
+{
+  char *buf, enc[4];
+  int n, i;
+
+  n = pic_utf8_encode(c, enc);
+  buf = pic_alloca(pic, len * n);
+  if (n == 1) {
+    memset(buf, c, len);
+  } else {
+    for (i = 0; i < len; ++i) {
+      memcpy(buf + i * n, enc, n);
+    }
+  }
+  return pic_str_value(pic, buf, len * n);
 }
 
 static pic_value
 pic_str_make_string(pic_state *pic)
 {
-  int len;
-  char c = ' ';
-  char *buf;
+  int len, c = ' ';
 
-  pic_get_args(pic, "i|c", &len, &c);
+  pic_get_args(pic, "i|C", &len, &c);
 
   if (len < 0) {
     pic_error(pic, "make-string: negative length given", 1, pic_int_value(pic, len));
   }
 
-  buf = pic_alloca(pic, len);
-
-  memset(buf, c, len);
-
-  return pic_str_value(pic, buf, len);
+  return str_fill(pic, c, len);
 }
 
 static pic_value
@@ -394,17 +1242,17 @@ static pic_value
 pic_str_string_set(pic_state *pic)
 {
   pic_value str, x, y, z;
-  char c;
-  int k, len;
+  char buf[4];
+  int k, len, c;
 
-  pic_get_args(pic, "sic", &str, &k, &c);
+  pic_get_args(pic, "siC", &str, &k, &c);
 
   len = pic_str_len(pic, str);
 
   VALID_INDEX(pic, len, k);
 
   x = pic_str_sub(pic, str, 0, k);
-  y = pic_str_value(pic, &c, 1);
+  y = pic_str_value(pic, buf, pic_utf8_encode(c, buf));
   z = pic_str_sub(pic, str, k + 1, len);
 
   str_update(pic, str, pic_str_cat(pic, x, pic_str_cat(pic, y, z)));
@@ -412,7 +1260,7 @@ pic_str_string_set(pic_state *pic)
   return pic_undef_value(pic);
 }
 
-#define DEFINE_STRING_CMP(name, op)                             \
+#define DEFINE_STRING_CMP(name, test)                           \
   static pic_value                                              \
   pic_str_string_##name(pic_state *pic)                         \
   {                                                             \
@@ -429,18 +1277,18 @@ pic_str_string_set(pic_state *pic)
       if (! pic_str_p(pic, argv[i])) {                          \
         return pic_false_value(pic);                            \
       }                                                         \
-      if (! (pic_str_cmp(pic, argv[i-1], argv[i]) op 0)) {      \
+      if (! (test)) {                                           \
         return pic_false_value(pic);                            \
       }                                                         \
     }                                                           \
     return pic_true_value(pic);                                 \
   }
 
-DEFINE_STRING_CMP(eq, ==)
-DEFINE_STRING_CMP(lt, <)
-DEFINE_STRING_CMP(gt, >)
-DEFINE_STRING_CMP(le, <=)
-DEFINE_STRING_CMP(ge, >=)
+DEFINE_STRING_CMP(eq, pic_str_equal_p(pic, argv[i-1], argv[i]))
+DEFINE_STRING_CMP(lt, pic_str_cmp(pic, argv[i-1], argv[i]) < 0)
+DEFINE_STRING_CMP(gt, pic_str_cmp(pic, argv[i-1], argv[i]) > 0)
+DEFINE_STRING_CMP(le, pic_str_cmp(pic, argv[i-1], argv[i]) <= 0)
+DEFINE_STRING_CMP(ge, pic_str_cmp(pic, argv[i-1], argv[i]) >= 0)
 
 static pic_value
 pic_str_string_copy(pic_state *pic)
@@ -497,10 +1345,9 @@ static pic_value
 pic_str_string_fill_ip(pic_state *pic)
 {
   pic_value str, x, y, z;
-  char c, *buf;
-  int n, start, end, len;
+  int n, start, end, len, c;
 
-  n = pic_get_args(pic, "sc|ii", &str, &c, &start, &end);
+  n = pic_get_args(pic, "sC|ii", &str, &c, &start, &end);
 
   len = pic_str_len(pic, str);
 
@@ -513,11 +1360,8 @@ pic_str_string_fill_ip(pic_state *pic)
 
   VALID_RANGE(pic, len, start, end);
 
-  buf = pic_alloca(pic, end - start);
-  memset(buf, c, end - start);
-
   x = pic_str_sub(pic, str, 0, start);
-  y = pic_str_value(pic, buf, end - start);
+  y = str_fill(pic, c, end - start);
   z = pic_str_sub(pic, str, end, len);
 
   str_update(pic, str, pic_str_cat(pic, x, pic_str_cat(pic, y, z)));
@@ -545,7 +1389,7 @@ static pic_value
 pic_str_string_map(pic_state *pic)
 {
   pic_value proc, *argv, vals, val;
-  int argc, i, len, j;
+  int argc, i, len, j, n;
   char *buf;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
@@ -562,9 +1406,9 @@ pic_str_string_map(pic_state *pic)
     len = len < l ? len : l;
   }
 
-  buf = pic_alloca(pic, len);
+  buf = pic_alloca(pic, len * 4);
 
-  for (i = 0; i < len; ++i) {
+  for (i = 0, n = 0; i < len; ++i) {
     vals = pic_nil_value(pic);
     for (j = 0; j < argc; ++j) {
       pic_push(pic, pic_char_value(pic, pic_str_ref(pic, argv[j], i)), vals);
@@ -574,9 +1418,9 @@ pic_str_string_map(pic_state *pic)
 
     TYPE_CHECK(pic, val, char);
 
-    buf[i] = pic_char(pic, val);
+    n += pic_utf8_encode(pic_char(pic, val), buf + n);
   }
-  return pic_str_value(pic, buf, len);
+  return pic_str_value(pic, buf, n);
 }
 
 static pic_value
@@ -619,13 +1463,13 @@ pic_str_list_to_string(pic_state *pic)
 
   pic_get_args(pic, "o", &list);
 
-  buf = pic_alloca(pic, pic_length(pic, list));
+  buf = pic_alloca(pic, pic_length(pic, list) * 4);
 
   i = 0;
   pic_for_each (e, list, it) {
     TYPE_CHECK(pic, e, char);
 
-    buf[i++] = pic_char(pic, e);
+    i += pic_utf8_encode(pic_char(pic, e), buf + i);
   }
 
   return pic_str_value(pic, buf, i);
@@ -657,6 +1501,160 @@ pic_str_string_to_list(pic_state *pic)
   return pic_reverse(pic, list);
 }
  
+static pic_value
+pic_str_string_index(pic_state *pic)
+{
+  pic_value str, pred;
+  struct rope tmp;
+  int n, start, end, len, i;
+
+  n = pic_get_args(pic, "so|ii", &str, &pred, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  if (pic_char_p(pic, pred)) {
+    char buf[4];
+
+    i = str_search(STR_VIEW(pic, str, tmp), buf, pic_utf8_encode(pic_char(pic, pred), buf), start, end);
+  } else {
+    for (i = start; i < end; ++i) {
+      if (! pic_false_p(pic, pic_call(pic, pred, 1, pic_char_value(pic, pic_str_ref(pic, str, i))))) {
+        break;
+      }
+    }
+    if (i == end) {
+      i = -1;
+    }
+  }
+  return i == -1 ? pic_false_value(pic) : pic_int_value(pic, i);
+}
+
+static pic_value
+pic_str_string_search_forward(pic_state *pic)
+{
+  pic_value pat, str;
+  struct rope tmp;
+  int n, start, i;
+
+  n = pic_get_args(pic, "ss|i", &pat, &str, &start);
+
+  if (n == 2) {
+    start = 0;
+  }
+
+  VALID_RANGE(pic, pic_str_len(pic, str), start, start);
+
+  i = str_search(STR_VIEW(pic, str, tmp), pic_str(pic, pat), pic_str_nbytes(pic, pat), start, pic_str_len(pic, str));
+
+  return i == -1 ? pic_false_value(pic) : pic_int_value(pic, i);
+}
+
+static pic_value
+pic_str_string_contains(pic_state *pic)
+{
+  pic_value str, pat;
+  struct rope tmp;
+  int n, start, end, len, i;
+
+  n = pic_get_args(pic, "ss|ii", &str, &pat, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  i = str_search(STR_VIEW(pic, str, tmp), pic_str(pic, pat), pic_str_nbytes(pic, pat), start, end);
+
+  return i == -1 ? pic_false_value(pic) : pic_int_value(pic, i);
+}
+
+static pic_value
+pic_str_string_split(pic_state *pic)
+{
+  pic_value str, list = pic_nil_value(pic);
+  struct rope tmp, *rope;
+  char buf[4];
+  int len, i, j, c, n;
+
+  pic_get_args(pic, "sC", &str, &c);
+
+  len = pic_str_len(pic, str);
+  rope = STR_VIEW(pic, str, tmp);
+  n = pic_utf8_encode(c, buf);
+
+  /* long fields are slices sharing the leaves of str */
+  for (i = 0; (j = str_search(rope, buf, n, i, len)) != -1; i = j + 1) {
+    pic_push(pic, pic_str_sub(pic, str, i, j), list);
+  }
+  pic_push(pic, pic_str_sub(pic, str, i, len), list);
+
+  return pic_reverse(pic, list);
+}
+
+static pic_value
+pic_str_string_join(pic_state *pic)
+{
+  pic_value list, delim, str, it;
+  struct rope **ropes, *r;
+  int n, len, i, j;
+
+  n = pic_get_args(pic, "o|s", &list, &delim);
+
+  if (n == 1) {
+    delim = pic_lit_value(pic, " ");
+  }
+
+  pic_for_each (str, list, it) {
+    TYPE_CHECK(pic, str, str);
+  }
+
+  len = pic_length(pic, list);
+  if (len == 0) {
+    return pic_lit_value(pic, "");
+  }
+
+  /* merge neighbours pairwise, so that the result is balanced from the
+     start instead of being rebalanced along a left spine */
+  ropes = pic_malloc(pic, sizeof(struct rope *) * (2 * len - 1));
+  i = 0;
+  pic_for_each (str, list, it) {
+    if (i > 0) {
+      ropes[i++] = str_share(pic, pic_str_ptr(pic, delim));
+    }
+    ropes[i++] = str_share(pic, pic_str_ptr(pic, str));
+  }
+  for (n = i; n > 1; n = j) {
+    for (i = j = 0; i + 1 < n; i += 2) {
+      r = merge(pic, ropes[i], ropes[i + 1]);
+      pic_rope_decref(pic, ropes[i]);
+      pic_rope_decref(pic, ropes[i + 1]);
+      ropes[j++] = r;
+    }
+    if (i < n) {
+      ropes[j++] = ropes[i];
+    }
+  }
+  r = ropes[0];
+  pic_free(pic, ropes);
+
+  return make_str(pic, r);
+}
+
 void
 pic_init_str(pic_state *pic)
 {
@@ -670,6 +1668,11 @@ pic_init_str(pic_state *pic)
   pic_defun(pic, "string-copy!", pic_str_string_copy_ip);
   pic_defun(pic, "string-fill!", pic_str_string_fill_ip);
   pic_defun(pic, "string-append", pic_str_string_append);
+  pic_defun(pic, "string-index", pic_str_string_index);
+  pic_defun(pic, "string-search-forward", pic_str_string_search_forward);
+  pic_defun(pic, "string-contains", pic_str_string_contains);
+  pic_defun(pic, "string-split", pic_str_string_split);
+  pic_defun(pic, "string-join", pic_str_string_join);
   pic_defun(pic, "string-map", pic_str_string_map);
   pic_defun(pic, "string-for-each", pic_str_string_for_each);
   pic_defun(pic, "list->string", pic_str_list_to_string);
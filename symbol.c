@@ -8,10 +8,20 @@
 #include "picrin/private/state.h"
 
 #define kh_pic_str_hash(a) (pic_str_hash(pic, pic_obj_value(a)))
-#define kh_pic_str_cmp(a, b) (pic_str_cmp(pic, pic_obj_value(a), pic_obj_value(b)) == 0)
+#define kh_pic_str_cmp(a, b) (pic_str_equal_p(pic, pic_obj_value(a), pic_obj_value(b)))
 
 KHASH_DEFINE(oblist, struct string *, symbol *, kh_pic_str_hash, kh_pic_str_cmp)
 
+struct bytes_key {
+  const char *str;
+  int len, hash;
+};
+
+#define kh_bytes_hash(a) ((a)->hash)
+#define kh_bytes_cmp(a, b) (pic_str_nbytes(pic, pic_obj_value(a)) == (b)->len && memcmp(pic_str(pic, pic_obj_value(a)), (b)->str, (b)->len) == 0)
+
+static KHASH_DEFINE_GET(oblist, get_oblist_bytes, const struct bytes_key *, kh_bytes_hash, kh_bytes_cmp)
+
 pic_value
 pic_intern(pic_state *pic, pic_value str)
 {
@@ -36,6 +46,39 @@ pic_intern(pic_state *pic, pic_value str)
   return pic_obj_value(sym);
 }
 
+pic_value
+pic_intern_str(pic_state *pic, const char *str, int len)
+{
+  khash_t(oblist) *h = &pic->oblist;
+  struct bytes_key key;
+  int it;
+
+  /* look the bytes up first so that no string is made for a known symbol */
+  key.str = str;
+  key.len = len < 0 ? -len : len;
+  key.hash = pic_str_hash_bytes(str, key.len);
+
+  it = kh_get_oblist_bytes(pic, h, &key);
+  if (it != kh_end(h)) {
+    symbol *sym = kh_val(h, it);
+    pic_protect(pic, pic_obj_value(sym));
+    return pic_obj_value(sym);
+  }
+  return pic_intern(pic, pic_str_value(pic, str, len));
+}
+
+/* a fresh symbol that is not interned */
+pic_value
+pic_make_symbol(pic_state *pic, pic_value str)
+{
+  symbol *sym;
+
+  sym = (symbol *)pic_obj_alloc(pic, offsetof(symbol, env), PIC_TYPE_SYMBOL);
+  sym->u.str = pic_str_ptr(pic, str);
+
+  return pic_obj_value(sym);
+}
+
 pic_value
 pic_make_identifier(pic_state *pic, pic_value base, pic_value env)
 {
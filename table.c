@@ -0,0 +1,633 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/private/object.h"
+
+/* hash tables keyed under eq?, eqv?, equal? or string=? (SRFI-69 subset).
+
+   entries live in an open-addressed array with linear probing. each slot
+   keeps the hash of its key, which doubles as the slot state: 0 marks an
+   empty slot and 1 a deleted one. when the array fills up a larger one is
+   allocated, and the entries of the old array are moved over a few slots
+   per update instead of all at once, so that no single insertion pays for
+   rehashing a large table. lookups consult both arrays in the meantime. */
+
+#define TABLE_INIT_SIZE 8
+#define TABLE_MOVE_STEP 8
+#define TABLE_EMPTY 0
+#define TABLE_DELETED 1
+
+#define table_full_p(s) (((s)->used + 1) * 4 > (s)->capa * 3)
+
+static int
+hash_word(uint64_t w)
+{
+  /* murmur3 fmix64 */
+  w ^= w >> 33;
+  w *= 0xff51afd7ed558ccdULL;
+  w ^= w >> 33;
+  w *= 0xc4ceb9fe1a85ec53ULL;
+  w ^= w >> 33;
+  return (int)(uint32_t)w;
+}
+
+static int
+hash_float(double f)
+{
+  uint64_t w;
+
+  if (f == 0) {
+    f = 0;                      /* -0.0 is eqv? to 0.0 */
+  }
+  memcpy(&w, &f, sizeof w);
+  return hash_word(w);
+}
+
+/* agrees with eqv?, and hence with eq? too */
+static int
+hash_eqv(pic_state *pic, pic_value v)
+{
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_INT:
+    return hash_word((uint64_t)pic_fixnum(pic, v));
+  case PIC_TYPE_CHAR:
+    return hash_word((uint64_t)pic_char(pic, v) << 8 | PIC_TYPE_CHAR);
+  case PIC_TYPE_FLOAT:
+    return hash_float(pic_float(pic, v));
+  case PIC_TYPE_BIGNUM: {
+    struct bignum *big = pic_bignum_ptr(pic, v);
+
+    return pic_str_hash_bytes((const char *)big->digits, big->len * sizeof(uint32_t)) ^ big->neg;
+  }
+  default:
+    if (pic_obj_p(pic, v)) {
+      return hash_word((uintptr_t)pic_obj_ptr(v));
+    }
+    return hash_word(pic_type(pic, v));
+  }
+}
+
+/* agrees with equal?. only a bounded part of the structure is looked at,
+   which also keeps circular structures from looping. */
+static int
+hash_equal(pic_state *pic, pic_value v, int *budget)
+{
+  int h, i, len;
+
+  if (--*budget < 0) {
+    return 0;
+  }
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_STRING:
+    return pic_str_hash(pic, v);
+  case PIC_TYPE_BLOB: {
+    const unsigned char *buf = pic_blob(pic, v, &len);
+
+    return pic_str_hash_bytes((const char *)buf, len);
+  }
+  case PIC_TYPE_PAIR:
+    h = hash_equal(pic, pic_car(pic, v), budget);
+    return hash_word((uint64_t)(unsigned)h << 32 | (unsigned)hash_equal(pic, pic_cdr(pic, v), budget));
+  case PIC_TYPE_VECTOR:
+    h = len = pic_vec_len(pic, v);
+    for (i = 0; i < len && *budget > 0; ++i) {
+      h = hash_word((uint64_t)(unsigned)h << 32 | (unsigned)hash_equal(pic, pic_vec_ref(pic, v, i), budget));
+    }
+    return h;
+  case PIC_TYPE_ID:
+    return PIC_TYPE_ID;         /* compared by what they resolve to */
+  case PIC_TYPE_DATA:
+    return hash_word((uintptr_t)pic_data(pic, v));
+  default:
+    return hash_eqv(pic, v);
+  }
+}
+
+static int
+table_hash(pic_state *pic, struct table *t, pic_value key)
+{
+  int h, budget = 16;
+
+  switch (t->kind) {
+  case PIC_TABLE_EQUAL:
+    h = hash_equal(pic, key, &budget);
+    break;
+  case PIC_TABLE_STRING:
+    h = pic_str_hash(pic, key);
+    break;
+  default:
+    h = hash_eqv(pic, key);
+    break;
+  }
+  h &= INT_MAX;                 /* states and hashes are told apart by sign */
+  return h <= TABLE_DELETED ? h + 2 : h;
+}
+
+static bool
+table_equal(pic_state *pic, struct table *t, pic_value a, pic_value b)
+{
+  switch (t->kind) {
+  case PIC_TABLE_EQ:
+    return pic_eq_p(pic, a, b);
+  case PIC_TABLE_EQV:
+    return pic_eqv_p(pic, a, b);
+  case PIC_TABLE_EQUAL:
+    return pic_equal_p(pic, a, b);
+  default:
+    return pic_str_equal_p(pic, a, b);
+  }
+}
+
+/* index of key in s, or -1 */
+static int
+slots_find(pic_state *pic, struct table *t, struct table_slots *s, pic_value key, int h)
+{
+  int mask = s->capa - 1, i;
+
+  if (s->ents == NULL) {
+    return -1;
+  }
+  for (i = h & mask; s->ents[i].hash != TABLE_EMPTY; i = (i + 1) & mask) {
+    if (s->ents[i].hash == h && table_equal(pic, t, s->ents[i].key, key)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* the key must not be present yet; there must be room */
+static struct table_ent *
+slots_add(struct table_slots *s, int h)
+{
+  int mask = s->capa - 1, i;
+
+  for (i = h & mask; s->ents[i].hash > TABLE_DELETED; i = (i + 1) & mask)
+    ;
+  if (s->ents[i].hash == TABLE_EMPTY) {
+    s->used++;
+  }
+  s->ents[i].hash = h;
+  return &s->ents[i];
+}
+
+static void
+slots_init(pic_state *pic, struct table_slots *s, int capa)
+{
+  s->capa = capa;
+  s->used = 0;
+  s->ents = pic_calloc(pic, capa, sizeof(struct table_ent));
+}
+
+static void
+table_move(pic_state *pic, struct table *t, int n)
+{
+  struct table_ent *e, *f;
+
+  while (n-- > 0 && t->moved < t->old.capa) {
+    e = &t->old.ents[t->moved++];
+    if (e->hash > TABLE_DELETED) {
+      f = slots_add(&t->cur, e->hash);
+      f->key = e->key;
+      f->val = e->val;
+      e->hash = TABLE_DELETED;
+    }
+  }
+  if (t->old.ents && t->moved == t->old.capa) {
+    pic_free(pic, t->old.ents);
+    t->old.ents = NULL;
+    t->old.capa = t->old.used = 0;
+  }
+}
+
+static void
+table_grow(pic_state *pic, struct table *t)
+{
+  int capa = t->cur.capa;
+
+  if (t->old.ents) {
+    table_move(pic, t, t->old.capa);   /* cannot keep up; finish now */
+  }
+  /* mostly deleted slots are cleaned at the same size */
+  if (t->size * 4 > capa) {
+    capa *= 2;
+  }
+  t->old = t->cur;
+  t->moved = 0;
+  slots_init(pic, &t->cur, capa);
+}
+
+pic_value
+pic_make_table(pic_state *pic, int kind, bool weak)
+{
+  struct table *t;
+
+  t = (struct table *)pic_obj_alloc(pic, sizeof(struct table), PIC_TYPE_TABLE);
+  t->kind = kind;
+  t->weak = weak;
+  t->size = 0;
+  t->moved = 0;
+  t->prev = NULL;
+  t->old.capa = t->old.used = 0;
+  t->old.ents = NULL;
+  slots_init(pic, &t->cur, TABLE_INIT_SIZE);
+
+  return pic_obj_value(t);
+}
+
+static struct table_ent *
+table_lookup(pic_state *pic, struct table *t, pic_value key, int h)
+{
+  int i;
+
+  if ((i = slots_find(pic, t, &t->cur, key, h)) >= 0) {
+    return &t->cur.ents[i];
+  }
+  if ((i = slots_find(pic, t, &t->old, key, h)) >= 0) {
+    return &t->old.ents[i];
+  }
+  return NULL;
+}
+
+#define TABLE_KEY_CHECK(pic, t, key) do {                               \
+    if ((t)->kind == PIC_TABLE_STRING && ! pic_str_p(pic, key)) {       \
+      pic_error(pic, "string-keyed hash table requires a string key", 1, key); \
+    }                                                                   \
+  } while (0)
+
+bool
+pic_table_has(pic_state *pic, pic_value table, pic_value key)
+{
+  struct table *t = pic_table_ptr(pic, table);
+
+  TABLE_KEY_CHECK(pic, t, key);
+
+  return table_lookup(pic, t, key, table_hash(pic, t, key)) != NULL;
+}
+
+pic_value
+pic_table_ref(pic_state *pic, pic_value table, pic_value key)
+{
+  struct table *t = pic_table_ptr(pic, table);
+  struct table_ent *e;
+
+  TABLE_KEY_CHECK(pic, t, key);
+
+  if ((e = table_lookup(pic, t, key, table_hash(pic, t, key))) == NULL) {
+    pic_error(pic, "element not found for given key", 1, key);
+  }
+  return e->val;
+}
+
+void
+pic_table_set(pic_state *pic, pic_value table, pic_value key, pic_value val)
+{
+  struct table *t = pic_table_ptr(pic, table);
+  struct table_ent *e;
+  int h;
+
+  TABLE_KEY_CHECK(pic, t, key);
+
+  h = table_hash(pic, t, key);
+
+  if ((e = table_lookup(pic, t, key, h)) != NULL) {
+    e->val = val;
+    return;
+  }
+  if (table_full_p(&t->cur)) {
+    table_grow(pic, t);
+  }
+  table_move(pic, t, TABLE_MOVE_STEP);
+
+  e = slots_add(&t->cur, h);
+  e->key = key;
+  e->val = val;
+  t->size++;
+}
+
+void
+pic_table_del(pic_state *pic, pic_value table, pic_value key)
+{
+  struct table *t = pic_table_ptr(pic, table);
+  struct table_ent *e;
+
+  TABLE_KEY_CHECK(pic, t, key);
+
+  if ((e = table_lookup(pic, t, key, table_hash(pic, t, key))) == NULL) {
+    pic_error(pic, "element not found for given key", 1, key);
+  }
+  e->hash = TABLE_DELETED;
+  t->size--;
+
+  table_move(pic, t, TABLE_MOVE_STEP);
+}
+
+int
+pic_table_size(pic_state *pic, pic_value table)
+{
+  return pic_table_ptr(pic, table)->size;
+}
+
+void
+pic_table_clear(pic_state *pic, pic_value table)
+{
+  struct table *t = pic_table_ptr(pic, table);
+
+  if (t->old.ents) {
+    pic_free(pic, t->old.ents);
+    t->old.ents = NULL;
+    t->old.capa = t->old.used = 0;
+  }
+  pic_free(pic, t->cur.ents);
+  slots_init(pic, &t->cur, TABLE_INIT_SIZE);
+  t->size = 0;
+}
+
+/* slots of the old array come first. safe to resume after the table has
+   been updated, though entries may then be skipped or seen twice. */
+bool
+pic_table_next(pic_state *pic, pic_value table, int *iter, pic_value *key, pic_value *val)
+{
+  struct table *t = pic_table_ptr(pic, table);
+  struct table_ent *e;
+  int it;
+
+  for (it = *iter; it < t->old.capa + t->cur.capa; ++it) {
+    e = it < t->old.capa ? &t->old.ents[it] : &t->cur.ents[it - t->old.capa];
+    if (e->hash > TABLE_DELETED) {
+      if (key) *key = e->key;
+      if (val) *val = e->val;
+      *iter = it + 1;
+      return true;
+    }
+  }
+  *iter = it;
+  return false;
+}
+
+static pic_value
+make_table(pic_state *pic, int kind, bool weak)
+{
+  int size;
+
+  pic_get_args(pic, "|i", &size);     /* only a hint; tables grow anyway */
+
+  return pic_make_table(pic, kind, weak);
+}
+
+static pic_value
+pic_table_make_eq_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_EQ, false);
+}
+
+static pic_value
+pic_table_make_eqv_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_EQV, false);
+}
+
+static pic_value
+pic_table_make_equal_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_EQUAL, false);
+}
+
+static pic_value
+pic_table_make_string_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_STRING, false);
+}
+
+static pic_value
+pic_table_make_key_weak_eq_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_EQ, true);
+}
+
+static pic_value
+pic_table_make_key_weak_eqv_hash_table(pic_state *pic)
+{
+  return make_table(pic, PIC_TABLE_EQV, true);
+}
+
+static pic_value
+pic_table_hash_table_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_table_p(pic, obj));
+}
+
+static pic_value
+pic_table_hash_table_ref(pic_state *pic)
+{
+  pic_value table, key, fail, succeed;
+  int n;
+
+  n = pic_get_args(pic, "oo|ll", &table, &key, &fail, &succeed);
+
+  TYPE_CHECK(pic, table, table);
+
+  if (! pic_table_has(pic, table, key)) {
+    if (n < 3) {
+      pic_error(pic, "hash-table-ref: key not found", 1, key);
+    }
+    return pic_call(pic, fail, 0);
+  }
+  if (n < 4) {
+    return pic_table_ref(pic, table, key);
+  }
+  return pic_call(pic, succeed, 1, pic_table_ref(pic, table, key));
+}
+
+static pic_value
+pic_table_hash_table_ref_default(pic_state *pic)
+{
+  pic_value table, key, def;
+
+  pic_get_args(pic, "ooo", &table, &key, &def);
+
+  TYPE_CHECK(pic, table, table);
+
+  if (! pic_table_has(pic, table, key)) {
+    return def;
+  }
+  return pic_table_ref(pic, table, key);
+}
+
+static pic_value
+pic_table_hash_table_set(pic_state *pic)
+{
+  pic_value table, key, val;
+
+  pic_get_args(pic, "ooo", &table, &key, &val);
+
+  TYPE_CHECK(pic, table, table);
+
+  pic_table_set(pic, table, key, val);
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_delete(pic_state *pic)
+{
+  pic_value table, key;
+
+  pic_get_args(pic, "oo", &table, &key);
+
+  TYPE_CHECK(pic, table, table);
+
+  if (pic_table_has(pic, table, key)) {
+    pic_table_del(pic, table, key);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_contains_p(pic_state *pic)
+{
+  pic_value table, key;
+
+  pic_get_args(pic, "oo", &table, &key);
+
+  TYPE_CHECK(pic, table, table);
+
+  return pic_bool_value(pic, pic_table_has(pic, table, key));
+}
+
+static pic_value
+pic_table_hash_table_size(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TYPE_CHECK(pic, table, table);
+
+  return pic_int_value(pic, pic_table_size(pic, table));
+}
+
+static pic_value
+pic_table_hash_table_update_default(pic_state *pic)
+{
+  pic_value table, key, proc, def;
+
+  pic_get_args(pic, "oolo", &table, &key, &proc, &def);
+
+  TYPE_CHECK(pic, table, table);
+
+  if (pic_table_has(pic, table, key)) {
+    def = pic_table_ref(pic, table, key);
+  }
+  pic_table_set(pic, table, key, pic_call(pic, proc, 1, def));
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_clear(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TYPE_CHECK(pic, table, table);
+
+  pic_table_clear(pic, table);
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_walk(pic_state *pic)
+{
+  pic_value table, proc, key, val;
+  int it = 0;
+
+  pic_get_args(pic, "ol", &table, &proc);
+
+  TYPE_CHECK(pic, table, table);
+
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    pic_call(pic, proc, 2, key, val);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_keys(pic_state *pic)
+{
+  pic_value table, key, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "o", &table);
+
+  TYPE_CHECK(pic, table, table);
+
+  while (pic_table_next(pic, table, &it, &key, NULL)) {
+    pic_push(pic, key, list);
+  }
+  return list;
+}
+
+static pic_value
+pic_table_hash_table_values(pic_state *pic)
+{
+  pic_value table, val, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "o", &table);
+
+  TYPE_CHECK(pic, table, table);
+
+  while (pic_table_next(pic, table, &it, NULL, &val)) {
+    pic_push(pic, val, list);
+  }
+  return list;
+}
+
+static pic_value
+pic_table_hash_table_to_alist(pic_state *pic)
+{
+  pic_value table, key, val, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "o", &table);
+
+  TYPE_CHECK(pic, table, table);
+
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    pic_push(pic, pic_cons(pic, key, val), list);
+  }
+  return list;
+}
+
+void
+pic_init_table(pic_state *pic)
+{
+  pic_defun(pic, "make-eq-hash-table", pic_table_make_eq_hash_table);
+  pic_defun(pic, "make-eqv-hash-table", pic_table_make_eqv_hash_table);
+  pic_defun(pic, "make-equal-hash-table", pic_table_make_equal_hash_table);
+  pic_defun(pic, "make-string-hash-table", pic_table_make_string_hash_table);
+  pic_defun(pic, "make-key-weak-eq-hash-table", pic_table_make_key_weak_eq_hash_table);
+  pic_defun(pic, "make-key-weak-eqv-hash-table", pic_table_make_key_weak_eqv_hash_table);
+  pic_defun(pic, "hash-table?", pic_table_hash_table_p);
+  pic_defun(pic, "hash-table-ref", pic_table_hash_table_ref);
+  pic_defun(pic, "hash-table-ref/default", pic_table_hash_table_ref_default);
+  pic_defun(pic, "hash-table-set!", pic_table_hash_table_set);
+  pic_defun(pic, "hash-table-delete!", pic_table_hash_table_delete);
+  pic_defun(pic, "hash-table-contains?", pic_table_hash_table_contains_p);
+  pic_defun(pic, "hash-table-size", pic_table_hash_table_size);
+  pic_defun(pic, "hash-table-update!/default", pic_table_hash_table_update_default);
+  pic_defun(pic, "hash-table-clear!", pic_table_hash_table_clear);
+  pic_defun(pic, "hash-table-walk", pic_table_hash_table_walk);
+  pic_defun(pic, "hash-table-keys", pic_table_hash_table_keys);
+  pic_defun(pic, "hash-table-values", pic_table_hash_table_values);
+  pic_defun(pic, "hash-table->alist", pic_table_hash_table_to_alist);
+}
@@ -0,0 +1,762 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/private/object.h"
+
+/* homogeneous numeric vectors (SRFI-4 subset).
+   elements are stored unboxed in a bytevector, which makes the conversion
+   from and to bytevectors a matter of sharing that bytevector. */
+
+pic_value pic_add(pic_state *, pic_value, pic_value);
+pic_value pic_mul(pic_state *, pic_value, pic_value);
+
+static const char *uvec_tags[] = { "f64", "f32", "s32", "u32", "s64" };
+static const char *uvec_required[] = {
+  "f64vector required", "f32vector required", "s32vector required", "u32vector required", "s64vector required"
+};
+static const int uvec_size[] = { 8, 4, 4, 4, 8 };
+
+#define uvec_float_p(kind) ((kind) == PIC_UVEC_F64 || (kind) == PIC_UVEC_F32)
+
+/* expands OP(T, U) with the element type T and the type U in which element
+   arithmetic is done. integer elements wrap around on overflow. */
+#define UVEC_DISPATCH(kind, OP) do {                    \
+    switch (kind) {                                     \
+    case PIC_UVEC_F64: OP(double, double); break;       \
+    case PIC_UVEC_F32: OP(float, float); break;         \
+    case PIC_UVEC_S32: OP(int32_t, uint32_t); break;    \
+    case PIC_UVEC_U32: OP(uint32_t, uint32_t); break;   \
+    case PIC_UVEC_S64: OP(int64_t, uint64_t); break;    \
+    }                                                   \
+  } while (0)
+
+static pic_value
+uvec_make(pic_state *pic, int kind, int len)
+{
+  struct uvector *uv;
+  struct blob *bv;
+
+  if (len < 0) {
+    pic_error(pic, "negative length given", 1, pic_int_value(pic, len));
+  }
+  if (len > INT_MAX / uvec_size[kind]) {
+    pic_error(pic, "length too large", 1, pic_int_value(pic, len));
+  }
+  bv = pic_blob_ptr(pic, pic_blob_value(pic, NULL, len * uvec_size[kind]));
+  if ((uintptr_t)bv->data % uvec_size[kind] != 0) {
+    /* inline storage is only pointer-aligned */
+    bv->data = pic_malloc(pic, len * uvec_size[kind]);
+  }
+  memset(bv->data, 0, len * uvec_size[kind]);
+
+  uv = (struct uvector *)pic_obj_alloc(pic, sizeof(struct uvector), PIC_TYPE_UVECTOR);
+  uv->kind = kind;
+  uv->len = len;
+  uv->blob = bv;
+  return pic_obj_value(uv);
+}
+
+static struct uvector *
+uvec_arg(pic_state *pic, pic_value v, int kind)
+{
+  if (! pic_uvec_p(pic, v) || pic_uvec_ptr(pic, v)->kind != kind) {
+    pic_error(pic, uvec_required[kind], 1, v);
+  }
+  return pic_uvec_ptr(pic, v);
+}
+
+static double
+uvec_double(pic_state *pic, pic_value x)
+{
+  if (pic_float_p(pic, x)) {
+    return pic_float(pic, x);
+  }
+  if (pic_int_p(pic, x)) {
+    return (double)pic_fixnum(pic, x);
+  }
+  if (pic_bignum_p(pic, x)) {
+    return pic_big_to_double(pic, x);
+  }
+  pic_error(pic, "number required", 1, x);
+}
+
+static int64_t
+uvec_int64(pic_state *pic, pic_value x, int64_t min, int64_t max)
+{
+  int64_t i;
+
+  if (pic_int_p(pic, x)) {
+    i = pic_fixnum(pic, x);
+  } else if (pic_bignum_p(pic, x)) {
+    if (! pic_big_to_int64(pic, x, &i)) {
+      pic_error(pic, "value out of range", 1, x);
+    }
+  } else {
+    pic_error(pic, "exact integer required", 1, x);
+  }
+  if (i < min || max < i) {
+    pic_error(pic, "value out of range", 1, x);
+  }
+  return i;
+}
+
+static pic_value
+uvec_box(pic_state *pic, int kind, const void *data, int k)
+{
+  switch (kind) {
+  case PIC_UVEC_F64:
+    return pic_float_value(pic, ((const double *)data)[k]);
+  case PIC_UVEC_F32:
+    return pic_float_value(pic, ((const float *)data)[k]);
+  case PIC_UVEC_S32:
+    return pic_int_value(pic, ((const int32_t *)data)[k]);
+  case PIC_UVEC_U32:
+    return pic_big_from_int64(pic, ((const uint32_t *)data)[k]);
+  default:
+    return pic_big_from_int64(pic, ((const int64_t *)data)[k]);
+  }
+}
+
+static void
+uvec_unbox(pic_state *pic, int kind, void *data, int k, pic_value x)
+{
+  switch (kind) {
+  case PIC_UVEC_F64:
+    ((double *)data)[k] = uvec_double(pic, x);
+    break;
+  case PIC_UVEC_F32:
+    ((float *)data)[k] = (float)uvec_double(pic, x);
+    break;
+  case PIC_UVEC_S32:
+    ((int32_t *)data)[k] = (int32_t)uvec_int64(pic, x, INT32_MIN, INT32_MAX);
+    break;
+  case PIC_UVEC_U32:
+    ((uint32_t *)data)[k] = (uint32_t)uvec_int64(pic, x, 0, UINT32_MAX);
+    break;
+  default:
+    ((int64_t *)data)[k] = uvec_int64(pic, x, INT64_MIN, INT64_MAX);
+    break;
+  }
+}
+
+const char *
+pic_uvec_tag(pic_state *pic, pic_value uvec)
+{
+  return uvec_tags[pic_uvec_ptr(pic, uvec)->kind];
+}
+
+pic_value
+pic_uvec_ref(pic_state *pic, pic_value uvec, int k)
+{
+  struct uvector *uv = pic_uvec_ptr(pic, uvec);
+
+  return uvec_box(pic, uv->kind, uv->blob->data, k);
+}
+
+static pic_value
+uvec_p(pic_state *pic, int kind)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, pic_uvec_p(pic, v) && pic_uvec_ptr(pic, v)->kind == kind);
+}
+
+static pic_value
+uvec_make_uvector(pic_state *pic, int kind)
+{
+  pic_value uvec, init;
+  struct uvector *uv;
+  int k, i, n;
+
+  n = pic_get_args(pic, "i|o", &k, &init);
+
+  uvec = uvec_make(pic, kind, k);
+  if (n == 2 && k > 0) {
+    uv = pic_uvec_ptr(pic, uvec);
+    uvec_unbox(pic, kind, uv->blob->data, 0, init);
+    for (i = 1; i < k; ++i) {
+      memcpy(uv->blob->data + i * uvec_size[kind], uv->blob->data, uvec_size[kind]);
+    }
+  }
+  return uvec;
+}
+
+static pic_value
+uvec_uvector(pic_state *pic, int kind)
+{
+  pic_value *argv, uvec;
+  int argc, i;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  uvec = uvec_make(pic, kind, argc);
+  for (i = 0; i < argc; ++i) {
+    uvec_unbox(pic, kind, pic_uvec_ptr(pic, uvec)->blob->data, i, argv[i]);
+  }
+  return uvec;
+}
+
+static pic_value
+uvec_length(pic_state *pic, int kind)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_int_value(pic, uvec_arg(pic, v, kind)->len);
+}
+
+static pic_value
+uvec_ref(pic_state *pic, int kind)
+{
+  pic_value v;
+  struct uvector *uv;
+  int k;
+
+  pic_get_args(pic, "oi", &v, &k);
+
+  uv = uvec_arg(pic, v, kind);
+  VALID_INDEX(pic, uv->len, k);
+
+  return uvec_box(pic, kind, uv->blob->data, k);
+}
+
+static pic_value
+uvec_set(pic_state *pic, int kind)
+{
+  pic_value v, x;
+  struct uvector *uv;
+  int k;
+
+  pic_get_args(pic, "oio", &v, &k, &x);
+
+  uv = uvec_arg(pic, v, kind);
+  VALID_INDEX(pic, uv->len, k);
+  uvec_unbox(pic, kind, uv->blob->data, k, x);
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+uvec_to_list(pic_state *pic, int kind)
+{
+  pic_value v, list = pic_nil_value(pic);
+  struct uvector *uv;
+  int n, start, end, i;
+
+  n = pic_get_args(pic, "o|ii", &v, &start, &end);
+
+  uv = uvec_arg(pic, v, kind);
+
+  switch (n) {
+  case 1:
+    start = 0;
+  case 2:
+    end = uv->len;
+  }
+
+  VALID_RANGE(pic, uv->len, start, end);
+
+  for (i = end - 1; i >= start; --i) {
+    pic_push(pic, uvec_box(pic, kind, uv->blob->data, i), list);
+  }
+  return list;
+}
+
+static pic_value
+uvec_list_to_uvector(pic_state *pic, int kind)
+{
+  pic_value list, uvec, e, it;
+  int i = 0;
+
+  pic_get_args(pic, "o", &list);
+
+  uvec = uvec_make(pic, kind, pic_length(pic, list));
+  pic_for_each (e, list, it) {
+    uvec_unbox(pic, kind, pic_uvec_ptr(pic, uvec)->blob->data, i++, e);
+  }
+  return uvec;
+}
+
+static pic_value
+uvec_copy(pic_state *pic, int kind)
+{
+  pic_value v, to;
+  struct uvector *uv;
+  int n, start, end;
+
+  n = pic_get_args(pic, "o|ii", &v, &start, &end);
+
+  uv = uvec_arg(pic, v, kind);
+
+  switch (n) {
+  case 1:
+    start = 0;
+  case 2:
+    end = uv->len;
+  }
+
+  VALID_RANGE(pic, uv->len, start, end);
+
+  to = uvec_make(pic, kind, end - start);
+  memcpy(pic_uvec_ptr(pic, to)->blob->data, uv->blob->data + start * uvec_size[kind], (end - start) * uvec_size[kind]);
+  return to;
+}
+
+static pic_value
+uvec_copy_i(pic_state *pic, int kind)
+{
+  pic_value to, from;
+  struct uvector *t, *f;
+  int n, at, start, end;
+
+  n = pic_get_args(pic, "oio|ii", &to, &at, &from, &start, &end);
+
+  t = uvec_arg(pic, to, kind);
+  f = uvec_arg(pic, from, kind);
+
+  switch (n) {
+  case 3:
+    start = 0;
+  case 4:
+    end = f->len;
+  }
+
+  VALID_ATRANGE(pic, t->len, at, f->len, start, end);
+
+  memmove(t->blob->data + at * uvec_size[kind], f->blob->data + start * uvec_size[kind], (end - start) * uvec_size[kind]);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+uvec_fill_i(pic_state *pic, int kind)
+{
+  pic_value v, x;
+  struct uvector *uv;
+  int n, start, end;
+
+  n = pic_get_args(pic, "oo|ii", &v, &x, &start, &end);
+
+  uv = uvec_arg(pic, v, kind);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = uv->len;
+  }
+
+  VALID_RANGE(pic, uv->len, start, end);
+
+  if (start == end) {
+    return pic_undef_value(pic);
+  }
+  uvec_unbox(pic, kind, uv->blob->data, start, x);
+
+#define FILL(T, U) do {                                 \
+    T *d = (T *)uv->blob->data, e = d[start];           \
+    int i;                                              \
+    for (i = start + 1; i < end; ++i) {                 \
+      d[i] = e;                                         \
+    }                                                   \
+  } while (0)
+
+  UVEC_DISPATCH(kind, FILL);
+
+#undef FILL
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+uvec_to_bytevector(pic_state *pic, int kind)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_obj_value(uvec_arg(pic, v, kind)->blob);
+}
+
+static pic_value
+uvec_from_bytevector(pic_state *pic, int kind)
+{
+  pic_value blob;
+  struct uvector *uv;
+  struct blob *bv;
+
+  pic_get_args(pic, "o", &blob);
+
+  TYPE_CHECK(pic, blob, blob);
+
+  bv = pic_blob_ptr(pic, blob);
+  if (bv->len % uvec_size[kind] != 0) {
+    pic_error(pic, "bytevector length is not a multiple of the element size", 1, blob);
+  }
+  if ((uintptr_t)bv->data % uvec_size[kind] != 0) {
+    pic_error(pic, "bytevector storage is not aligned for the element type", 1, blob);
+  }
+
+  uv = (struct uvector *)pic_obj_alloc(pic, sizeof(struct uvector), PIC_TYPE_UVECTOR);
+  uv->kind = kind;
+  uv->len = bv->len / uvec_size[kind];
+  uv->blob = bv;
+  return pic_obj_value(uv);
+}
+
+/* bulk kernels: the element type is resolved once per call, leaving plain
+   loops over typed arrays for the compiler to vectorize */
+
+static void
+uvec_args2(pic_state *pic, int kind, struct uvector **x, struct uvector **y)
+{
+  pic_value a, b;
+
+  pic_get_args(pic, "oo", &a, &b);
+
+  *x = uvec_arg(pic, a, kind);
+  *y = uvec_arg(pic, b, kind);
+  if ((*x)->len != (*y)->len) {
+    pic_error(pic, "length mismatch", 2, a, b);
+  }
+}
+
+static pic_value
+uvec_add_i(pic_state *pic, int kind)
+{
+  struct uvector *x, *y;
+
+  uvec_args2(pic, kind, &x, &y);
+
+#define ADD(T, U) do {                                  \
+    T *d = (T *)x->blob->data;                          \
+    const T *s = (const T *)y->blob->data;              \
+    int i, n = x->len;                                  \
+    for (i = 0; i < n; ++i) {                           \
+      d[i] = (T)((U)d[i] + (U)s[i]);                    \
+    }                                                   \
+  } while (0)
+
+  UVEC_DISPATCH(kind, ADD);
+
+#undef ADD
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+uvec_mul_i(pic_state *pic, int kind)
+{
+  struct uvector *x, *y;
+
+  uvec_args2(pic, kind, &x, &y);
+
+#define MUL(T, U) do {                                  \
+    T *d = (T *)x->blob->data;                          \
+    const T *s = (const T *)y->blob->data;              \
+    int i, n = x->len;                                  \
+    for (i = 0; i < n; ++i) {                           \
+      d[i] = (T)((U)d[i] * (U)s[i]);                    \
+    }                                                   \
+  } while (0)
+
+  UVEC_DISPATCH(kind, MUL);
+
+#undef MUL
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+uvec_scale_i(pic_state *pic, int kind)
+{
+  pic_value v, k;
+  struct uvector *uv;
+  double f = 0;
+  int64_t i = 0;
+
+  pic_get_args(pic, "oo", &v, &k);
+
+  uv = uvec_arg(pic, v, kind);
+  if (uvec_float_p(kind)) {
+    f = uvec_double(pic, k);
+  } else {
+    i = uvec_int64(pic, k, INT64_MIN, INT64_MAX);
+  }
+
+#define SCALE(T, U) do {                                        \
+    T *d = (T *)uv->blob->data;                                 \
+    U s = uvec_float_p(kind) ? (U)f : (U)i;                     \
+    int j, n = uv->len;                                         \
+    for (j = 0; j < n; ++j) {                                   \
+      d[j] = (T)((U)d[j] * s);                                  \
+    }                                                           \
+  } while (0)
+
+  UVEC_DISPATCH(kind, SCALE);
+
+#undef SCALE
+
+  return pic_undef_value(pic);
+}
+
+/* exact fallback for integer reductions that leave the int64 range */
+static pic_value
+uvec_reduce_exact(pic_state *pic, struct uvector *x, struct uvector *y)
+{
+  pic_value acc = pic_int_value(pic, 0), t;
+  size_t ai = pic_enter(pic);
+  int i;
+
+  for (i = 0; i < x->len; ++i) {
+    t = uvec_box(pic, x->kind, x->blob->data, i);
+    if (y) {
+      t = pic_mul(pic, t, uvec_box(pic, y->kind, y->blob->data, i));
+    }
+    acc = pic_add(pic, acc, t);
+    pic_leave(pic, ai);
+    pic_protect(pic, acc);
+  }
+  return acc;
+}
+
+static pic_value
+uvec_sum(pic_state *pic, int kind)
+{
+  pic_value v;
+  struct uvector *uv;
+  int i, n;
+
+  pic_get_args(pic, "o", &v);
+
+  uv = uvec_arg(pic, v, kind);
+  n = uv->len;
+
+  /* four independent accumulators break the dependency chain */
+#define SUM(T, A) do {                                          \
+    const T *d = (const T *)uv->blob->data;                     \
+    A s0 = 0, s1 = 0, s2 = 0, s3 = 0;                           \
+    for (i = 0; i + 4 <= n; i += 4) {                           \
+      s0 += d[i]; s1 += d[i + 1]; s2 += d[i + 2]; s3 += d[i + 3]; \
+    }                                                           \
+    for (; i < n; ++i) {                                        \
+      s0 += d[i];                                               \
+    }                                                           \
+    sum = (s0 + s1) + (s2 + s3);                                \
+  } while (0)
+
+  switch (kind) {
+  case PIC_UVEC_F64: {
+    double sum;
+    SUM(double, double);
+    return pic_float_value(pic, sum);
+  }
+  case PIC_UVEC_F32: {
+    double sum;
+    SUM(float, double);
+    return pic_float_value(pic, sum);
+  }
+  case PIC_UVEC_S32: {
+    /* at most 2^31 elements of magnitude 2^31 cannot overflow */
+    int64_t sum;
+    SUM(int32_t, int64_t);
+    return pic_big_from_int64(pic, sum);
+  }
+  case PIC_UVEC_U32: {
+    int64_t sum;
+    SUM(uint32_t, int64_t);
+    return pic_big_from_int64(pic, sum);
+  }
+  default: {
+    const int64_t *d = (const int64_t *)uv->blob->data;
+    int64_t sum = 0;
+    for (i = 0; i < n; ++i) {
+      if ((d[i] > 0 && sum > INT64_MAX - d[i]) || (d[i] < 0 && sum < INT64_MIN - d[i])) {
+        return uvec_reduce_exact(pic, uv, NULL);
+      }
+      sum += d[i];
+    }
+    return pic_big_from_int64(pic, sum);
+  }
+  }
+
+#undef SUM
+}
+
+static bool
+mul_overflow_p(int64_t a, int64_t b)
+{
+  if (a == 0 || b == 0) {
+    return false;
+  }
+  if (a > 0) {
+    return b > 0 ? a > INT64_MAX / b : b < INT64_MIN / a;
+  } else {
+    return b > 0 ? a < INT64_MIN / b : a < INT64_MAX / b;
+  }
+}
+
+static pic_value
+uvec_dot(pic_state *pic, int kind)
+{
+  struct uvector *x, *y;
+  int i, n;
+
+  uvec_args2(pic, kind, &x, &y);
+  n = x->len;
+
+#define DOT(T) do {                                                     \
+    const T *a = (const T *)x->blob->data, *b = (const T *)y->blob->data; \
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;                              \
+    for (i = 0; i + 4 <= n; i += 4) {                                   \
+      s0 += (double)a[i] * b[i];                                        \
+      s1 += (double)a[i + 1] * b[i + 1];                                \
+      s2 += (double)a[i + 2] * b[i + 2];                                \
+      s3 += (double)a[i + 3] * b[i + 3];                                \
+    }                                                                   \
+    for (; i < n; ++i) {                                                \
+      s0 += (double)a[i] * b[i];                                        \
+    }                                                                   \
+    return pic_float_value(pic, (s0 + s1) + (s2 + s3));                 \
+  } while (0)
+
+#define IDOT(T) do {                                                    \
+    const T *a = (const T *)x->blob->data, *b = (const T *)y->blob->data; \
+    int64_t sum = 0, p;                                                 \
+    for (i = 0; i < n; ++i) {                                           \
+      if (mul_overflow_p(a[i], b[i])) {                                 \
+        return uvec_reduce_exact(pic, x, y);                            \
+      }                                                                 \
+      p = (int64_t)a[i] * (int64_t)b[i];                                \
+      if ((p > 0 && sum > INT64_MAX - p) || (p < 0 && sum < INT64_MIN - p)) { \
+        return uvec_reduce_exact(pic, x, y);                            \
+      }                                                                 \
+      sum += p;                                                         \
+    }                                                                   \
+    return pic_big_from_int64(pic, sum);                                \
+  } while (0)
+
+  switch (kind) {
+  case PIC_UVEC_F64:
+    DOT(double);
+  case PIC_UVEC_F32:
+    DOT(float);
+  case PIC_UVEC_S32:
+    IDOT(int32_t);
+  case PIC_UVEC_U32:
+    IDOT(uint32_t);
+  default:
+    IDOT(int64_t);
+  }
+
+#undef DOT
+#undef IDOT
+}
+
+static pic_value
+uvec_minmax(pic_state *pic, int kind, bool max)
+{
+  pic_value v;
+  struct uvector *uv;
+  int k = 0;
+
+  pic_get_args(pic, "o", &v);
+
+  uv = uvec_arg(pic, v, kind);
+  if (uv->len == 0) {
+    pic_error(pic, "empty vector", 1, v);
+  }
+
+  /* track the value rather than the index so that the loop is a plain reduction */
+#define MINMAX(T, U) do {                                       \
+    const T *d = (const T *)uv->blob->data;                     \
+    T m = d[0];                                                 \
+    int i, n = uv->len;                                         \
+    if (max) {                                                  \
+      for (i = 1; i < n; ++i) {                                 \
+        m = d[i] > m ? d[i] : m;                                \
+      }                                                         \
+    } else {                                                    \
+      for (i = 1; i < n; ++i) {                                 \
+        m = d[i] < m ? d[i] : m;                                \
+      }                                                         \
+    }                                                           \
+    for (i = 0; i < n; ++i) {                                   \
+      if (d[i] == m) {                                          \
+        k = i;                                                  \
+        break;                                                  \
+      }                                                         \
+    }                                                           \
+  } while (0)
+
+  UVEC_DISPATCH(kind, MINMAX);
+
+#undef MINMAX
+
+  return uvec_box(pic, kind, uv->blob->data, k);
+}
+
+#define DEFINE_UVEC_PROCS(tag, kind)                                    \
+  static pic_value pic_##tag##_p(pic_state *pic) { return uvec_p(pic, kind); } \
+  static pic_value pic_make_##tag(pic_state *pic) { return uvec_make_uvector(pic, kind); } \
+  static pic_value pic_##tag(pic_state *pic) { return uvec_uvector(pic, kind); } \
+  static pic_value pic_##tag##_length(pic_state *pic) { return uvec_length(pic, kind); } \
+  static pic_value pic_##tag##_ref(pic_state *pic) { return uvec_ref(pic, kind); } \
+  static pic_value pic_##tag##_set(pic_state *pic) { return uvec_set(pic, kind); } \
+  static pic_value pic_##tag##_to_list(pic_state *pic) { return uvec_to_list(pic, kind); } \
+  static pic_value pic_list_to_##tag(pic_state *pic) { return uvec_list_to_uvector(pic, kind); } \
+  static pic_value pic_##tag##_copy(pic_state *pic) { return uvec_copy(pic, kind); } \
+  static pic_value pic_##tag##_copy_i(pic_state *pic) { return uvec_copy_i(pic, kind); } \
+  static pic_value pic_##tag##_fill_i(pic_state *pic) { return uvec_fill_i(pic, kind); } \
+  static pic_value pic_##tag##_to_bytevector(pic_state *pic) { return uvec_to_bytevector(pic, kind); } \
+  static pic_value pic_bytevector_to_##tag(pic_state *pic) { return uvec_from_bytevector(pic, kind); } \
+  static pic_value pic_##tag##_add_i(pic_state *pic) { return uvec_add_i(pic, kind); } \
+  static pic_value pic_##tag##_mul_i(pic_state *pic) { return uvec_mul_i(pic, kind); } \
+  static pic_value pic_##tag##_scale_i(pic_state *pic) { return uvec_scale_i(pic, kind); } \
+  static pic_value pic_##tag##_sum(pic_state *pic) { return uvec_sum(pic, kind); } \
+  static pic_value pic_##tag##_dot(pic_state *pic) { return uvec_dot(pic, kind); } \
+  static pic_value pic_##tag##_min(pic_state *pic) { return uvec_minmax(pic, kind, false); } \
+  static pic_value pic_##tag##_max(pic_state *pic) { return uvec_minmax(pic, kind, true); }
+
+DEFINE_UVEC_PROCS(f64vector, PIC_UVEC_F64)
+DEFINE_UVEC_PROCS(f32vector, PIC_UVEC_F32)
+DEFINE_UVEC_PROCS(s32vector, PIC_UVEC_S32)
+DEFINE_UVEC_PROCS(u32vector, PIC_UVEC_U32)
+DEFINE_UVEC_PROCS(s64vector, PIC_UVEC_S64)
+
+#define DEFUN_UVEC_PROCS(tag)                                           \
+  pic_defun(pic, #tag "?", pic_##tag##_p);                              \
+  pic_defun(pic, "make-" #tag, pic_make_##tag);                         \
+  pic_defun(pic, #tag, pic_##tag);                                      \
+  pic_defun(pic, #tag "-length", pic_##tag##_length);                   \
+  pic_defun(pic, #tag "-ref", pic_##tag##_ref);                         \
+  pic_defun(pic, #tag "-set!", pic_##tag##_set);                        \
+  pic_defun(pic, #tag "->list", pic_##tag##_to_list);                   \
+  pic_defun(pic, "list->" #tag, pic_list_to_##tag);                     \
+  pic_defun(pic, #tag "-copy", pic_##tag##_copy);                       \
+  pic_defun(pic, #tag "-copy!", pic_##tag##_copy_i);                    \
+  pic_defun(pic, #tag "-fill!", pic_##tag##_fill_i);                    \
+  pic_defun(pic, #tag "->bytevector", pic_##tag##_to_bytevector);       \
+  pic_defun(pic, "bytevector->" #tag, pic_bytevector_to_##tag);         \
+  pic_defun(pic, #tag "-add!", pic_##tag##_add_i);                      \
+  pic_defun(pic, #tag "-mul!", pic_##tag##_mul_i);                      \
+  pic_defun(pic, #tag "-scale!", pic_##tag##_scale_i);                  \
+  pic_defun(pic, #tag "-sum", pic_##tag##_sum);                         \
+  pic_defun(pic, #tag "-dot", pic_##tag##_dot);                         \
+  pic_defun(pic, #tag "-min", pic_##tag##_min);                         \
+  pic_defun(pic, #tag "-max", pic_##tag##_max)
+
+void
+pic_init_uvector(pic_state *pic)
+{
+  DEFUN_UVEC_PROCS(f64vector);
+  DEFUN_UVEC_PROCS(f32vector);
+  DEFUN_UVEC_PROCS(s32vector);
+  DEFUN_UVEC_PROCS(u32vector);
+  DEFUN_UVEC_PROCS(s64vector);
+}
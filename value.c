@@ -39,7 +39,7 @@ pic_int(pic_state *PIC_UNUSED(pic), pic_value v)
   return u.i;
 }
 
-char
+int
 pic_char(pic_state *PIC_UNUSED(pic), pic_value v)
 {
   return v & 0xfffffffful;
@@ -51,6 +51,68 @@ pic_obj_ptr(pic_value v)
   return (struct object *)(0xfffffffffffful & v);
 }
 
+#elif PIC_WORD_BOXING
+
+/**
+ * value representation by low-bit tagging:
+ *   ptr   : PPPPPPPP ... PPPPPPPPPPPPPPPPPPPPPPPPPPPPPP00
+ *   int   : IIIIIIII ... IIIIIIIIIIIIIIIIIIIIIIIIIIIIII01
+ *   char  : 00000000 ... 000CCCCCCCCCCCCCCCCCCCCC00TTTT10
+ *   const : 00000000 ... 000000000000000000000000TTTT10
+ *
+ * floats are boxed in the heap as struct flonum.
+ */
+
+#define pic_init_value(v,vtype) (v = ((pic_value)(vtype) << 2) | 2)
+
+int
+pic_vtype(pic_state *PIC_UNUSED(pic), pic_value v)
+{
+  switch (v & 3) {
+  case 0:
+    return PIC_IVAL_END;
+  case 1:
+    return PIC_TYPE_INT;
+  default:
+    return (v >> 2) & 0xf;
+  }
+}
+
+double
+pic_float(pic_state *PIC_UNUSED(pic), pic_value v)
+{
+  return ((struct flonum *)pic_obj_ptr(v))->f;
+}
+
+pic_fixnum_t
+pic_fixnum(pic_state *PIC_UNUSED(pic), pic_value v)
+{
+  return (int64_t)v >> 2;
+}
+
+int
+pic_int(pic_state *pic, pic_value v)
+{
+  pic_fixnum_t n = pic_fixnum(pic, v);
+
+  if (n < INT_MIN || INT_MAX < n) {
+    pic_error(pic, "integer out of range", 1, v);
+  }
+  return (int)n;
+}
+
+int
+pic_char(pic_state *PIC_UNUSED(pic), pic_value v)
+{
+  return (v >> 8) & 0x1fffff;
+}
+
+struct object *
+pic_obj_ptr(pic_value v)
+{
+  return (struct object *)(uintptr_t)v;
+}
+
 #else
 
 #define pic_init_value(v,vtype) ((v).type = (vtype), (v).u.data = NULL)
@@ -73,7 +135,7 @@ pic_int(pic_state *PIC_UNUSED(pic), pic_value v)
   return v.u.i;
 }
 
-char
+int
 pic_char(pic_state *PIC_UNUSED(pic), pic_value v)
 {
   return v.u.c;
@@ -123,12 +185,56 @@ pic_int_value(pic_state *PIC_UNUSED(pic), int i)
 }
 
 pic_value
-pic_char_value(pic_state *PIC_UNUSED(pic), char c)
+pic_char_value(pic_state *PIC_UNUSED(pic), int c)
+{
+  pic_value v;
+
+  pic_init_value(v, PIC_TYPE_CHAR);
+  v |= (unsigned)c;
+  return v;
+}
+
+#elif PIC_WORD_BOXING
+
+pic_value
+pic_obj_value(void *ptr)
+{
+  assert(((uintptr_t)ptr & 3) == 0);
+
+  return (pic_value)(uintptr_t)ptr;
+}
+
+pic_value
+pic_float_value(pic_state *pic, double f)
+{
+  struct flonum *flo;
+
+  flo = (struct flonum *)pic_obj_alloc(pic, sizeof(struct flonum), PIC_TYPE_FLOAT);
+  flo->f = f;
+  return pic_obj_value(flo);
+}
+
+pic_value
+pic_fixnum_value(pic_state *PIC_UNUSED(pic), pic_fixnum_t i)
+{
+  assert(PIC_FIXNUM_MIN <= i && i <= PIC_FIXNUM_MAX);
+
+  return ((pic_value)i << 2) | 1;
+}
+
+pic_value
+pic_int_value(pic_state *pic, int i)
+{
+  return pic_fixnum_value(pic, i);
+}
+
+pic_value
+pic_char_value(pic_state *PIC_UNUSED(pic), int c)
 {
   pic_value v;
 
   pic_init_value(v, PIC_TYPE_CHAR);
-  v |= (unsigned char)c;
+  v |= (pic_value)c << 8;
   return v;
 }
 
@@ -165,7 +271,7 @@ pic_int_value(pic_state *PIC_UNUSED(pic), int i)
 }
 
 pic_value
-pic_char_value(pic_state *PIC_UNUSED(pic), char c)
+pic_char_value(pic_state *PIC_UNUSED(pic), int c)
 {
   pic_value v;
 
@@ -214,6 +320,8 @@ pic_typename(pic_state *pic, int type)
     return "float";
   case PIC_TYPE_INT:
     return "int";
+  case PIC_TYPE_BIGNUM:
+    return "bignum";
   case PIC_TYPE_SYMBOL:
     return "symbol";
   case PIC_TYPE_CHAR:
@@ -232,6 +340,10 @@ pic_typename(pic_state *pic, int type)
     return "vector";
   case PIC_TYPE_BLOB:
     return "bytevector";
+  case PIC_TYPE_UVECTOR:
+    return "uvector";
+  case PIC_TYPE_TABLE:
+    return "hash-table";
   case PIC_TYPE_PORT:
     return "port";
   case PIC_TYPE_ERROR:
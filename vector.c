@@ -12,9 +12,14 @@ pic_make_vec(pic_state *pic, int len, pic_value *argv)
   struct vector *vec;
   int i;
 
-  vec = (struct vector *)pic_obj_alloc(pic, sizeof(struct vector), PIC_TYPE_VECTOR);
+  if (len <= PIC_VEC_INLINE_SIZE) {
+    vec = (struct vector *)pic_obj_alloc(pic, offsetof(struct vector, storage) + sizeof(pic_value) * len, PIC_TYPE_VECTOR);
+    vec->data = vec->storage;
+  } else {
+    vec = (struct vector *)pic_obj_alloc(pic, sizeof(struct vector), PIC_TYPE_VECTOR);
+    vec->data = (pic_value *)pic_malloc(pic, sizeof(pic_value) * len);
+  }
   vec->len = len;
-  vec->data = (pic_value *)pic_malloc(pic, sizeof(pic_value) * len);
   if (argv == NULL) {
     for (i = 0; i < len; ++i) {
       vec->data[i] = pic_undef_value(pic);
@@ -352,16 +357,17 @@ pic_vec_vector_to_string(pic_state *pic)
 
   VALID_RANGE(pic, len, start, end);
 
-  buf = pic_alloca(pic, end - start);
+  buf = pic_alloca(pic, (end - start) * 4);
+  len = 0;
   for (i = start; i < end; ++i) {
     t = pic_vec_ref(pic, vec, i);
 
     TYPE_CHECK(pic, t, char);
 
-    buf[i - start] = pic_char(pic, t);
+    len += pic_utf8_encode(pic_char(pic, t), buf + len);
   }
 
-  return pic_str_value(pic, buf, end - start);
+  return pic_str_value(pic, buf, len);
 }
 
 static pic_value
@@ -120,14 +120,18 @@ write_blob(pic_state *pic, pic_value blob, xFILE *file)
 static void
 write_char(pic_state *pic, pic_value ch, xFILE *file, struct writer_control *p)
 {
-  char c = pic_char(pic, ch);
+  int c = pic_char(pic, ch), n;
+  char buf[4];
+
+  n = pic_utf8_encode(c, buf);
 
   if (p->mode == DISPLAY_MODE) {
-    xfputc(pic, c, file);
+    xfwrite(pic, buf, 1, n, file);
     return;
   }
   switch (c) {
-  default: xfprintf(pic, file, "#\\%c", c); break;
+  default: xfprintf(pic, file, "#\\"); xfwrite(pic, buf, 1, n, file); break;
+  case 0: xfprintf(pic, file, "#\\null"); break;
   case '\a': xfprintf(pic, file, "#\\alarm"); break;
   case '\b': xfprintf(pic, file, "#\\backspace"); break;
   case 0x7f: xfprintf(pic, file, "#\\delete"); break;
@@ -142,21 +146,39 @@ write_char(pic_state *pic, pic_value ch, xFILE *file, struct writer_control *p)
 static void
 write_str(pic_state *pic, pic_value str, xFILE *file, struct writer_control *p)
 {
-  int i;
+  int i, j, n = pic_str_nbytes(pic, str);
   const char *cstr = pic_str(pic, str);
 
   if (p->mode == DISPLAY_MODE) {
-    xfprintf(pic, file, "%s", pic_str(pic, str));
+    xfwrite(pic, cstr, 1, n, file);
     return;
   }
-  xfprintf(pic, file, "\"");
-  for (i = 0; i < pic_str_len(pic, str); ++i) {
+  xfputc(pic, '"', file);
+  for (i = j = 0; i < n; ++i) {
     if (cstr[i] == '"' || cstr[i] == '\\') {
+      xfwrite(pic, cstr + j, 1, i - j, file);
       xfputc(pic, '\\', file);
+      j = i;
     }
-    xfputc(pic, cstr[i], file);
   }
-  xfprintf(pic, file, "\"");
+  xfwrite(pic, cstr + j, 1, n - j, file);
+  xfputc(pic, '"', file);
+}
+
+static void
+write_int(pic_state *pic, pic_value i, xFILE *file)
+{
+  pic_fixnum_t n = pic_fixnum(pic, i);
+  char buf[32], *c = buf + sizeof buf;
+
+  *--c = '\0';
+  do {
+    *--c = '0' + (n % 10 < 0 ? -(n % 10) : n % 10);
+  } while ((n /= 10) != 0);
+  if (pic_fixnum(pic, i) < 0) {
+    *--c = '-';
+  }
+  xfprintf(pic, file, "%s", c);
 }
 
 static void
@@ -267,6 +289,21 @@ write_vec(pic_state *pic, pic_value vec, xFILE *file, struct writer_control *p)
   xfprintf(pic, file, ")");
 }
 
+static void
+write_uvec(pic_state *pic, pic_value uvec, xFILE *file, struct writer_control *p)
+{
+  int i, len = pic_uvec_ptr(pic, uvec)->len;
+
+  xfprintf(pic, file, "#%s(", pic_uvec_tag(pic, uvec));
+  for (i = 0; i < len; ++i) {
+    write_core(pic, pic_uvec_ref(pic, uvec, i), file, p);
+    if (i + 1 < len) {
+      xfprintf(pic, file, " ");
+    }
+  }
+  xfprintf(pic, file, ")");
+}
+
 static void
 write_dict(pic_state *pic, pic_value dict, xFILE *file, struct writer_control *p)
 {
@@ -318,7 +355,7 @@ write_core(pic_state *pic, pic_value obj, xFILE *file, struct writer_control *p)
     xfprintf(pic, file, "#.(eof-object)");
     break;
   case PIC_TYPE_INT:
-    xfprintf(pic, file, "%d", pic_int(pic, obj));
+    write_int(pic, obj, file);
     break;
   case PIC_TYPE_SYMBOL:
     xfprintf(pic, file, "%s", pic_sym(pic, obj));
@@ -326,9 +363,15 @@ write_core(pic_state *pic, pic_value obj, xFILE *file, struct writer_control *p)
   case PIC_TYPE_FLOAT:
     write_float(pic, obj, file);
     break;
+  case PIC_TYPE_BIGNUM:
+    xfprintf(pic, file, "%s", pic_str(pic, pic_big_to_string(pic, obj, 10)));
+    break;
   case PIC_TYPE_BLOB:
     write_blob(pic, obj, file);
     break;
+  case PIC_TYPE_UVECTOR:
+    write_uvec(pic, obj, file, p);
+    break;
   case PIC_TYPE_CHAR:
     write_char(pic, obj, file, p);
     break;